@@ -3,41 +3,37 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Misc/Crc.h"
+#include "Misc/SecureHash.h"
 
 class FGLTFBinaryHashKey
 {
 public:
 
+	// Only the length and SHA-1 digest of the data are kept (not a copy of the data itself), so that keys stay small
+	// when deduplicating large amounts of binary data (e.g. images) over the course of an export
 	FGLTFBinaryHashKey(const void* RawData, int64 ByteLength)
-		: Hash(FCrc::MemCrc32(RawData, ByteLength))
-		, Bytes(static_cast<const uint8*>(RawData), ByteLength)
+		: ByteLength(ByteLength)
 	{
+		FSHA1::HashBuffer(RawData, ByteLength, Digest.Hash);
 	}
 
 	bool operator==(const FGLTFBinaryHashKey& Other) const
 	{
-		return CompareBytes(Other);
+		return ByteLength == Other.ByteLength && Digest == Other.Digest;
 	}
 
 	bool operator!=(const FGLTFBinaryHashKey& Other) const
 	{
-		return !CompareBytes(Other);
+		return !(*this == Other);
 	}
 
 	friend uint32 GetTypeHash(const FGLTFBinaryHashKey& Other)
 	{
-		return Other.Hash;
+		return GetTypeHash(Other.Digest);
 	}
 
 private:
 
-	bool CompareBytes(const FGLTFBinaryHashKey& Other) const
-	{
-		return Bytes.Num() == Other.Bytes.Num()
-			&& FMemory::Memcmp(Bytes.GetData(), Other.Bytes.GetData(), Bytes.Num()) == 0;
-	}
-
-	const uint32 Hash;
-	const TArray64<uint8> Bytes;
+	int64 ByteLength;
+	FSHAHash Digest;
 };
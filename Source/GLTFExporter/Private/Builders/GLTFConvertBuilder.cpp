@@ -8,6 +8,46 @@ FGLTFConvertBuilder::FGLTFConvertBuilder(const FString& FilePath, const UGLTFExp
 {
 }
 
+FGLTFPositionQuantization FGLTFConvertBuilder::GetOrAddPositionQuantization(const FPositionVertexBuffer* VertexBuffer)
+{
+	if (VertexBuffer == nullptr)
+	{
+		return {};
+	}
+
+	return PositionQuantizationConverter.GetOrAdd(VertexBuffer);
+}
+
+const FGLTFSkinWeights* FGLTFConvertBuilder::GetOrAddSkinWeights(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer)
+{
+	if (MeshSection == nullptr || VertexBuffer == nullptr)
+	{
+		return nullptr;
+	}
+
+	return SkinWeightsConverter.GetOrAdd(MeshSection, VertexBuffer);
+}
+
+const FGLTFSkinJoints* FGLTFConvertBuilder::GetOrAddSkinJoints(const USkeletalMesh* SkeletalMesh)
+{
+	if (SkeletalMesh == nullptr)
+	{
+		return nullptr;
+	}
+
+	return SkinJointsConverter.GetOrAdd(SkeletalMesh);
+}
+
+const FGLTFJointPalettes* FGLTFConvertBuilder::GetOrAddJointPalettes(const USkeletalMesh* SkeletalMesh, int32 LODIndex)
+{
+	if (SkeletalMesh == nullptr || ExportOptions->MaximumJointsPerPrimitive <= 0)
+	{
+		return nullptr;
+	}
+
+	return JointPalettesConverter.GetOrAdd(SkeletalMesh, LODIndex);
+}
+
 FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddPositionAccessor(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer)
 {
 	if (VertexBuffer == nullptr)
@@ -18,6 +58,16 @@ FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddPositionAccessor(const FGLTF
 	return PositionBufferConverter.GetOrAdd(MeshSection, VertexBuffer);
 }
 
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddQuantizedPositionAccessor(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer)
+{
+	if (VertexBuffer == nullptr)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	return QuantizedPositionBufferConverter.GetOrAdd(MeshSection, VertexBuffer);
+}
+
 FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddColorAccessor(const FGLTFMeshSection* MeshSection, const FColorVertexBuffer* VertexBuffer)
 {
 	if (VertexBuffer == nullptr)
@@ -58,14 +108,14 @@ FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddUVAccessor(const FGLTFMeshSe
 	return UVBufferConverter.GetOrAdd(MeshSection, VertexBuffer, UVIndex);
 }
 
-FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddJointAccessor(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, int32 InfluenceOffset)
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddJointAccessor(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, int32 InfluenceOffset, const FGLTFSkinJoints* SkinJoints)
 {
-	if (VertexBuffer == nullptr)
+	if (VertexBuffer == nullptr || SkinJoints == nullptr)
 	{
 		return FGLTFJsonAccessorIndex(INDEX_NONE);
 	}
 
-	return BoneIndexBufferConverter.GetOrAdd(MeshSection, VertexBuffer, InfluenceOffset);
+	return BoneIndexBufferConverter.GetOrAdd(MeshSection, VertexBuffer, InfluenceOffset, SkinJoints);
 }
 
 FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddWeightAccessor(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, int32 InfluenceOffset)
@@ -78,6 +128,26 @@ FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddWeightAccessor(const FGLTFMe
 	return BoneWeightBufferConverter.GetOrAdd(MeshSection, VertexBuffer, InfluenceOffset);
 }
 
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddMorphTargetPositionAccessor(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex)
+{
+	if (MeshSection == nullptr || MorphTarget == nullptr)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	return MorphTargetPositionBufferConverter.GetOrAdd(MeshSection, MorphTarget, LODIndex);
+}
+
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddMorphTargetNormalAccessor(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex)
+{
+	if (MeshSection == nullptr || MorphTarget == nullptr)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	return MorphTargetNormalBufferConverter.GetOrAdd(MeshSection, MorphTarget, LODIndex);
+}
+
 FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddIndexAccessor(const FGLTFMeshSection* MeshSection)
 {
 	if (MeshSection == nullptr)
@@ -88,17 +158,47 @@ FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddIndexAccessor(const FGLTFMes
 	return IndexBufferConverter.GetOrAdd(MeshSection);
 }
 
-FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const UStaticMesh* StaticMesh, const FGLTFMaterialArray& Materials, int32 LODIndex)
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddAnimationInputAccessor(TArrayView<const float> Timestamps)
+{
+	if (Timestamps.Num() == 0)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	return AnimationInputConverter.GetOrAdd(Timestamps);
+}
+
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddAnimationOutputAccessor(TArrayView<const FGLTFVector3> Values)
+{
+	if (Values.Num() == 0)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	return AnimationVector3OutputConverter.GetOrAdd(Values);
+}
+
+FGLTFJsonAccessorIndex FGLTFConvertBuilder::GetOrAddAnimationOutputAccessor(TArrayView<const FGLTFQuaternion> Values)
+{
+	if (Values.Num() == 0)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	return AnimationQuaternionOutputConverter.GetOrAdd(Values);
+}
+
+FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const UStaticMesh* StaticMesh, const FGLTFMaterialArray& Materials, int32 LODIndex, bool bQuantizePositions)
 {
 	if (StaticMesh == nullptr)
 	{
 		return FGLTFJsonMeshIndex(INDEX_NONE);
 	}
 
-	return StaticMeshConverter.GetOrAdd(StaticMesh, nullptr, Materials, LODIndex);
+	return StaticMeshConverter.GetOrAdd(StaticMesh, nullptr, Materials, LODIndex, bQuantizePositions);
 }
 
-FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const UStaticMeshComponent* StaticMeshComponent, const FGLTFMaterialArray& Materials, int32 LODIndex)
+FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const UStaticMeshComponent* StaticMeshComponent, const FGLTFMaterialArray& Materials, int32 LODIndex, bool bQuantizePositions)
 {
 	if (StaticMeshComponent == nullptr)
 	{
@@ -111,20 +211,20 @@ FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const UStaticMeshComponent*
 		return FGLTFJsonMeshIndex(INDEX_NONE);
 	}
 
-	return StaticMeshConverter.GetOrAdd(StaticMesh, StaticMeshComponent, Materials, LODIndex);
+	return StaticMeshConverter.GetOrAdd(StaticMesh, StaticMeshComponent, Materials, LODIndex, bQuantizePositions);
 }
 
-FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const USkeletalMesh* SkeletalMesh, const FGLTFMaterialArray& Materials, int32 LODIndex)
+FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const USkeletalMesh* SkeletalMesh, const FGLTFMaterialArray& Materials, int32 LODIndex, int32 PaletteIndex)
 {
 	if (SkeletalMesh == nullptr)
 	{
 		return FGLTFJsonMeshIndex(INDEX_NONE);
 	}
 
-	return SkeletalMeshConverter.GetOrAdd(SkeletalMesh, nullptr, Materials, LODIndex);
+	return SkeletalMeshConverter.GetOrAdd(SkeletalMesh, nullptr, Materials, LODIndex, PaletteIndex);
 }
 
-FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const USkeletalMeshComponent* SkeletalMeshComponent, const FGLTFMaterialArray& Materials, int32 LODIndex)
+FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const USkeletalMeshComponent* SkeletalMeshComponent, const FGLTFMaterialArray& Materials, int32 LODIndex, int32 PaletteIndex)
 {
 	if (SkeletalMeshComponent == nullptr)
 	{
@@ -137,7 +237,7 @@ FGLTFJsonMeshIndex FGLTFConvertBuilder::GetOrAddMesh(const USkeletalMeshComponen
 		return FGLTFJsonMeshIndex(INDEX_NONE);
 	}
 
-	return SkeletalMeshConverter.GetOrAdd(SkeletalMesh, SkeletalMeshComponent, Materials, LODIndex);
+	return SkeletalMeshConverter.GetOrAdd(SkeletalMesh, SkeletalMeshComponent, Materials, LODIndex, PaletteIndex);
 }
 
 FGLTFJsonMaterialIndex FGLTFConvertBuilder::GetOrAddMaterial(const UMaterialInterface* Material, const FGLTFMeshData* MeshData, const FGLTFIndexArray& SectionIndices)
@@ -210,17 +310,17 @@ FGLTFJsonTextureIndex FGLTFConvertBuilder::GetOrAddTexture(const ULightMapTextur
 	return TextureLightMapConverter.GetOrAdd(Texture);
 }
 
-FGLTFJsonSkinIndex FGLTFConvertBuilder::GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh)
+FGLTFJsonSkinIndex FGLTFConvertBuilder::GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, const FGLTFSkinJoints* JointPalette, const USkeletalMesh* RootMesh)
 {
 	if (RootNode == INDEX_NONE || SkeletalMesh == nullptr)
 	{
 		return FGLTFJsonSkinIndex(INDEX_NONE);
 	}
 
-	return SkinConverter.GetOrAdd(RootNode, SkeletalMesh);
+	return SkinConverter.GetOrAdd(RootNode, SkeletalMesh, JointPalette, RootMesh);
 }
 
-FGLTFJsonSkinIndex FGLTFConvertBuilder::GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMeshComponent* SkeletalMeshComponent)
+FGLTFJsonSkinIndex FGLTFConvertBuilder::GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMeshComponent* SkeletalMeshComponent, const FGLTFSkinJoints* JointPalette, const USkeletalMesh* RootMesh)
 {
 	if (RootNode == INDEX_NONE || SkeletalMeshComponent == nullptr)
 	{
@@ -234,7 +334,7 @@ FGLTFJsonSkinIndex FGLTFConvertBuilder::GetOrAddSkin(FGLTFJsonNodeIndex RootNode
 		return FGLTFJsonSkinIndex(INDEX_NONE);
 	}
 
-	return GetOrAddSkin(RootNode, SkeletalMesh);
+	return GetOrAddSkin(RootNode, SkeletalMesh, JointPalette, RootMesh);
 }
 
 FGLTFJsonAnimationIndex FGLTFConvertBuilder::GetOrAddAnimation(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, const UAnimSequence* AnimSequence)
@@ -337,6 +437,16 @@ FGLTFJsonNodeIndex FGLTFConvertBuilder::GetOrAddNode(FGLTFJsonNodeIndex RootNode
 	return SkeletalBoneConverter.GetOrAdd(RootNode, SkeletalMesh, BoneIndex);
 }
 
+FGLTFJsonNodeIndex FGLTFConvertBuilder::FindNode(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, int32 BoneIndex)
+{
+	if (RootNode == INDEX_NONE || SkeletalMesh == nullptr || BoneIndex == INDEX_NONE)
+	{
+		return FGLTFJsonNodeIndex(INDEX_NONE);
+	}
+
+	return SkeletalBoneConverter.Get(RootNode, SkeletalMesh, BoneIndex);
+}
+
 FGLTFJsonSceneIndex FGLTFConvertBuilder::GetOrAddScene(const UWorld* World)
 {
 	if (World == nullptr)
@@ -387,14 +497,14 @@ FGLTFJsonLevelVariantSetsIndex FGLTFConvertBuilder::GetOrAddLevelVariantSets(con
 	return LevelVariantSetsConverter.GetOrAdd(LevelVariantSets);
 }
 
-FGLTFJsonLightMapIndex FGLTFConvertBuilder::GetOrAddLightMap(const UStaticMeshComponent* StaticMeshComponent)
+FGLTFJsonLightMapIndex FGLTFConvertBuilder::GetOrAddLightMap(const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex)
 {
 	if (StaticMeshComponent == nullptr)
 	{
 		return FGLTFJsonLightMapIndex(INDEX_NONE);
 	}
 
-	return LightMapConverter.GetOrAdd(StaticMeshComponent);
+	return LightMapConverter.GetOrAdd(StaticMeshComponent, LODIndex);
 }
 
 FGLTFJsonHotspotIndex FGLTFConvertBuilder::GetOrAddHotspot(const AGLTFHotspotActor* HotspotActor)
@@ -416,3 +526,25 @@ FGLTFJsonSkySphereIndex FGLTFConvertBuilder::GetOrAddSkySphere(const AActor* Sky
 
 	return SkySphereConverter.GetOrAdd(SkySphereActor);
 }
+
+void FGLTFConvertBuilder::OnTasksCompleted(EGLTFTaskPriority Priority)
+{
+	switch (Priority)
+	{
+		case EGLTFTaskPriority::Mesh:
+			// Mesh sections and skin weights are only read by mesh tasks
+			StaticMeshConverter.ReleaseMeshSections();
+			SkeletalMeshConverter.ReleaseMeshSections();
+			SkinWeightsConverter.ReleaseOutputs();
+			break;
+
+		case EGLTFTaskPriority::Material:
+			// Mesh descriptions are only read by material tasks (when baking with mesh data)
+			StaticMeshDataConverter.ReleaseOutputs();
+			SkeletalMeshDataConverter.ReleaseOutputs();
+			break;
+
+		default:
+			break;
+	}
+}
@@ -4,14 +4,20 @@
 
 #include "Builders/GLTFImageBuilder.h"
 #include "Converters/GLTFAccessorConverters.h"
+#include "Converters/GLTFQuantizationConverters.h"
+#include "Converters/GLTFSkinWeightConverters.h"
+#include "Converters/GLTFVertexBufferAnalysisConverters.h"
 #include "Converters/GLTFMeshConverters.h"
+#include "Converters/GLTFMeshSimplificationBudget.h"
 #include "Converters/GLTFMeshDataConverters.h"
 #include "Converters/GLTFMaterialConverters.h"
 #include "Converters/GLTFSamplerConverters.h"
 #include "Converters/GLTFTextureConverters.h"
 #include "Converters/GLTFNodeConverters.h"
 #include "Converters/GLTFSkinConverters.h"
+#include "Converters/GLTFJointPaletteConverters.h"
 #include "Converters/GLTFAnimationConverters.h"
+#include "Converters/GLTFAnimationAccessorConverters.h"
 #include "Converters/GLTFSceneConverters.h"
 #include "Converters/GLTFCameraConverters.h"
 #include "Converters/GLTFLightConverters.h"
@@ -31,23 +37,41 @@ public:
 
 	const bool bSelectedActorsOnly;
 
+	// Tile of the level being exported when exporting level tiles, or unset for the common file (holding all actors without bounds)
+	TOptional<FIntVector> ExportTile;
+
 	// TODO: find a better place for this types of indirect converters
 	FGLTFStaticMeshDataConverter StaticMeshDataConverter;
 	FGLTFSkeletalMeshDataConverter SkeletalMeshDataConverter;
+	FGLTFTangentBufferAnalysisConverter TangentBufferAnalysisConverter;
+	FGLTFColorBufferAnalysisConverter ColorBufferAnalysisConverter;
+
+	FGLTFMeshSimplificationBudget MeshSimplificationBudget{ *this };
+
+	FGLTFPositionQuantization GetOrAddPositionQuantization(const FPositionVertexBuffer* VertexBuffer);
+	const FGLTFSkinWeights* GetOrAddSkinWeights(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer);
+	const FGLTFSkinJoints* GetOrAddSkinJoints(const USkeletalMesh* SkeletalMesh);
+	const FGLTFJointPalettes* GetOrAddJointPalettes(const USkeletalMesh* SkeletalMesh, int32 LODIndex);
 
 	FGLTFJsonAccessorIndex GetOrAddPositionAccessor(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer);
+	FGLTFJsonAccessorIndex GetOrAddQuantizedPositionAccessor(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer);
 	FGLTFJsonAccessorIndex GetOrAddColorAccessor(const FGLTFMeshSection* MeshSection, const FColorVertexBuffer* VertexBuffer);
 	FGLTFJsonAccessorIndex GetOrAddNormalAccessor(const FGLTFMeshSection* MeshSection, const FStaticMeshVertexBuffer* VertexBuffer);
 	FGLTFJsonAccessorIndex GetOrAddTangentAccessor(const FGLTFMeshSection* MeshSection, const FStaticMeshVertexBuffer* VertexBuffer);
 	FGLTFJsonAccessorIndex GetOrAddUVAccessor(const FGLTFMeshSection* MeshSection, const FStaticMeshVertexBuffer* VertexBuffer, int32 UVIndex);
-	FGLTFJsonAccessorIndex GetOrAddJointAccessor(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, int32 InfluenceOffset);
+	FGLTFJsonAccessorIndex GetOrAddJointAccessor(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, int32 InfluenceOffset, const FGLTFSkinJoints* SkinJoints);
 	FGLTFJsonAccessorIndex GetOrAddWeightAccessor(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, int32 InfluenceOffset);
+	FGLTFJsonAccessorIndex GetOrAddMorphTargetPositionAccessor(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex);
+	FGLTFJsonAccessorIndex GetOrAddMorphTargetNormalAccessor(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex);
 	FGLTFJsonAccessorIndex GetOrAddIndexAccessor(const FGLTFMeshSection* MeshSection);
+	FGLTFJsonAccessorIndex GetOrAddAnimationInputAccessor(TArrayView<const float> Timestamps);
+	FGLTFJsonAccessorIndex GetOrAddAnimationOutputAccessor(TArrayView<const FGLTFVector3> Values);
+	FGLTFJsonAccessorIndex GetOrAddAnimationOutputAccessor(TArrayView<const FGLTFQuaternion> Values);
 
-	FGLTFJsonMeshIndex GetOrAddMesh(const UStaticMesh* StaticMesh, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1);
-	FGLTFJsonMeshIndex GetOrAddMesh(const UStaticMeshComponent* StaticMeshComponent, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1);
-	FGLTFJsonMeshIndex GetOrAddMesh(const USkeletalMesh* SkeletalMesh, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1);
-	FGLTFJsonMeshIndex GetOrAddMesh(const USkeletalMeshComponent* SkeletalMeshComponent, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1);
+	FGLTFJsonMeshIndex GetOrAddMesh(const UStaticMesh* StaticMesh, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1, bool bQuantizePositions = false);
+	FGLTFJsonMeshIndex GetOrAddMesh(const UStaticMeshComponent* StaticMeshComponent, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1, bool bQuantizePositions = false);
+	FGLTFJsonMeshIndex GetOrAddMesh(const USkeletalMesh* SkeletalMesh, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1, int32 PaletteIndex = -1);
+	FGLTFJsonMeshIndex GetOrAddMesh(const USkeletalMeshComponent* SkeletalMeshComponent, const FGLTFMaterialArray& Materials = {}, int32 LODIndex = -1, int32 PaletteIndex = -1);
 
 	FGLTFJsonMaterialIndex GetOrAddMaterial(const UMaterialInterface* Material, const FGLTFMeshData* MeshData = nullptr, const FGLTFIndexArray& SectionIndices = {});
 
@@ -58,8 +82,8 @@ public:
 	FGLTFJsonTextureIndex GetOrAddTexture(const UTextureRenderTargetCube* Texture, ECubeFace CubeFace);
 	FGLTFJsonTextureIndex GetOrAddTexture(const ULightMapTexture2D* Texture);
 
-	FGLTFJsonSkinIndex GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh);
-	FGLTFJsonSkinIndex GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMeshComponent* SkeletalMeshComponent);
+	FGLTFJsonSkinIndex GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, const FGLTFSkinJoints* JointPalette = nullptr, const USkeletalMesh* RootMesh = nullptr);
+	FGLTFJsonSkinIndex GetOrAddSkin(FGLTFJsonNodeIndex RootNode, const USkeletalMeshComponent* SkeletalMeshComponent, const FGLTFSkinJoints* JointPalette = nullptr, const USkeletalMesh* RootMesh = nullptr);
 	FGLTFJsonAnimationIndex GetOrAddAnimation(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, const UAnimSequence* AnimSequence);
 	FGLTFJsonAnimationIndex GetOrAddAnimation(FGLTFJsonNodeIndex RootNode, const USkeletalMeshComponent* SkeletalMeshComponent);
 	FGLTFJsonAnimationIndex GetOrAddAnimation(const ULevel* Level, const ULevelSequence* LevelSequence);
@@ -71,26 +95,42 @@ public:
 	FGLTFJsonNodeIndex GetOrAddNode(FGLTFJsonNodeIndex RootNode, const UStaticMesh* StaticMesh, FName SocketName);
 	FGLTFJsonNodeIndex GetOrAddNode(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, FName SocketName);
 	FGLTFJsonNodeIndex GetOrAddNode(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, int32 BoneIndex);
+	FGLTFJsonNodeIndex FindNode(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, int32 BoneIndex);
 	FGLTFJsonSceneIndex GetOrAddScene(const UWorld* World);
 
 	FGLTFJsonCameraIndex GetOrAddCamera(const UCameraComponent* CameraComponent);
 	FGLTFJsonLightIndex GetOrAddLight(const ULightComponent* LightComponent);
 	FGLTFJsonBackdropIndex GetOrAddBackdrop(const AActor* BackdropActor);
 	FGLTFJsonLevelVariantSetsIndex GetOrAddLevelVariantSets(const ULevelVariantSets* LevelVariantSets);
-	FGLTFJsonLightMapIndex GetOrAddLightMap(const UStaticMeshComponent* StaticMeshComponent);
+	FGLTFJsonLightMapIndex GetOrAddLightMap(const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex = -1);
 	FGLTFJsonHotspotIndex GetOrAddHotspot(const AGLTFHotspotActor* HotspotActor);
 	FGLTFJsonSkySphereIndex GetOrAddSkySphere(const AActor* SkySphereActor);
 
+protected:
+
+	virtual void OnTasksCompleted(EGLTFTaskPriority Priority) override;
+
 private:
 
+	FGLTFPositionQuantizationConverter PositionQuantizationConverter{ *this };
+	FGLTFSkinWeightsConverter SkinWeightsConverter{ *this };
+	FGLTFSkinJointsConverter SkinJointsConverter{ *this };
+	FGLTFJointPalettesConverter JointPalettesConverter{ *this };
+
 	FGLTFPositionBufferConverter PositionBufferConverter{ *this };
+	FGLTFQuantizedPositionBufferConverter QuantizedPositionBufferConverter{ *this };
 	FGLTFColorBufferConverter ColorBufferConverter{ *this };
 	FGLTFNormalBufferConverter NormalBufferConverter{ *this };
 	FGLTFTangentBufferConverter TangentBufferConverter{ *this };
 	FGLTFUVBufferConverter UVBufferConverter{ *this };
 	FGLTFBoneIndexBufferConverter BoneIndexBufferConverter{ *this };
 	FGLTFBoneWeightBufferConverter BoneWeightBufferConverter{ *this };
+	FGLTFMorphTargetPositionBufferConverter MorphTargetPositionBufferConverter{ *this };
+	FGLTFMorphTargetNormalBufferConverter MorphTargetNormalBufferConverter{ *this };
 	FGLTFIndexBufferConverter IndexBufferConverter{ *this };
+	FGLTFAnimationInputConverter AnimationInputConverter{ *this };
+	FGLTFAnimationVector3OutputConverter AnimationVector3OutputConverter{ *this };
+	FGLTFAnimationQuaternionOutputConverter AnimationQuaternionOutputConverter{ *this };
 
 	FGLTFStaticMeshConverter StaticMeshConverter{ *this };
 	FGLTFSkeletalMeshConverter SkeletalMeshConverter{ *this };
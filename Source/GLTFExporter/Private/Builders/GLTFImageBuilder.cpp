@@ -7,9 +7,15 @@
 
 FGLTFImageBuilder::FGLTFImageBuilder(const FString& FilePath, const UGLTFExportOptions* ExportOptions)
 	: FGLTFBufferBuilder(FilePath, ExportOptions)
+	, ImageFiles(MakeShared<FGLTFImageFiles>())
 {
 }
 
+void FGLTFImageBuilder::ShareImageFiles(const FGLTFImageBuilder& OtherBuilder)
+{
+	ImageFiles = OtherBuilder.ImageFiles;
+}
+
 FGLTFJsonImageIndex FGLTFImageBuilder::AddImage(const TArray<FColor>& Pixels, FIntPoint Size, bool bIgnoreAlpha, EGLTFTextureType Type, const FString& Name)
 {
 	check(Pixels.Num() == Size.X * Size.Y);
@@ -65,9 +71,17 @@ FGLTFJsonImageIndex FGLTFImageBuilder::AddImage(const void* CompressedData, int6
 			JsonImage.MimeType = MimeType;
 			JsonImage.BufferView = AddBufferView(CompressedData, CompressedByteLength);
 		}
+		else if (const FString* ExistingUri = ImageFiles->UrisByContent.Find(HashKey))
+		{
+			JsonImage.Uri = *ExistingUri;
+		}
 		else
 		{
 			JsonImage.Uri = SaveImageToFile(CompressedData, CompressedByteLength, MimeType, Name);
+			if (!JsonImage.Uri.IsEmpty())
+			{
+				ImageFiles->UrisByContent.Add(HashKey, JsonImage.Uri);
+			}
 		}
 
 		ImageIndex = FGLTFJsonBuilder::AddImage(JsonImage);
@@ -101,7 +115,7 @@ EGLTFJsonMimeType FGLTFImageBuilder::GetImageFormat(const FColor* Pixels, FIntPo
 FString FGLTFImageBuilder::SaveImageToFile(const void* CompressedData, int64 CompressedByteLength, EGLTFJsonMimeType MimeType, const FString& Name)
 {
 	const TCHAR* Extension = FGLTFFileUtility::GetFileExtension(MimeType);
-	const FString ImageUri = FGLTFFileUtility::GetUniqueFilename(Name, Extension, UniqueImageUris);
+	const FString ImageUri = FGLTFFileUtility::GetUniqueFilename(Name, Extension, ImageFiles->UniqueUris);
 
 	const TArrayView<const uint8> ImageData(static_cast<const uint8*>(CompressedData), CompressedByteLength);
 	const FString ImagePath = FPaths::Combine(DirPath, ImageUri);
@@ -112,6 +126,6 @@ FString FGLTFImageBuilder::SaveImageToFile(const void* CompressedData, int64 Com
 		return TEXT("");
 	}
 
-	UniqueImageUris.Add(ImageUri);
+	ImageFiles->UniqueUris.Add(ImageUri);
 	return ImageUri;
 }
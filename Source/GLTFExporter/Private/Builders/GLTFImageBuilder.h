@@ -16,8 +16,17 @@ public:
 	FGLTFJsonImageIndex AddImage(const TArray<FColor>& Pixels, FIntPoint Size, bool bIgnoreAlpha, EGLTFTextureType Type, const FString& Name);
 	FGLTFJsonImageIndex AddImage(const FColor* Pixels, int64 ByteLength, FIntPoint Size, bool bIgnoreAlpha, EGLTFTextureType Type, const FString& Name);
 
+	// Reuses the image files saved by another builder exporting to the same directory (e.g. other tiles of the same level), instead of saving duplicates
+	void ShareImageFiles(const FGLTFImageBuilder& OtherBuilder);
+
 private:
 
+	struct FGLTFImageFiles
+	{
+		TSet<FString> UniqueUris;
+		TMap<FGLTFBinaryHashKey, FString> UrisByContent;
+	};
+
 	FGLTFJsonImageIndex AddImage(const FColor* Pixels, FIntPoint Size, bool bIgnoreAlpha, EGLTFTextureType Type, const FString& Name);
 	FGLTFJsonImageIndex AddImage(const void* CompressedData, int64 CompressedByteLength, EGLTFJsonMimeType MimeType, const FString& Name);
 
@@ -25,6 +34,6 @@ private:
 
 	FString SaveImageToFile(const void* CompressedData, int64 CompressedByteLength, EGLTFJsonMimeType MimeType, const FString& Name);
 
-	TSet<FString> UniqueImageUris;
+	TSharedRef<FGLTFImageFiles> ImageFiles;
 	TMap<FGLTFBinaryHashKey, FGLTFJsonImageIndex> UniqueImageIndices;
 };
@@ -266,6 +266,25 @@ FGLTFJsonNodeIndex FGLTFJsonBuilder::GetComponentNodeIndex(FGLTFJsonNodeIndex No
 	return Node.ComponentNode != INDEX_NONE ? Node.ComponentNode : NodeIndex;
 }
 
+FGLTFJsonNodeIndex FGLTFJsonBuilder::SetNodeMesh(FGLTFJsonNodeIndex NodeIndex, FGLTFJsonMeshIndex MeshIndex)
+{
+	if (MeshIndex == INDEX_NONE || !GetMesh(MeshIndex).bQuantizedPositions)
+	{
+		GetNode(NodeIndex).Mesh = MeshIndex;
+		return NodeIndex;
+	}
+
+	const FGLTFJsonMesh& JsonMesh = GetMesh(MeshIndex);
+
+	FGLTFJsonNode MeshNode;
+	MeshNode.Name = GetNode(NodeIndex).Name;
+	MeshNode.Translation = JsonMesh.DequantizationTranslation;
+	MeshNode.Scale = JsonMesh.DequantizationScale;
+	MeshNode.Mesh = MeshIndex;
+
+	return AddChildNode(NodeIndex, MeshNode);
+}
+
 FString FGLTFJsonBuilder::GetGeneratorString() const
 {
 	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(GLTFEXPORTER_MODULE_NAME);
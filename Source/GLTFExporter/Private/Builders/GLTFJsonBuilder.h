@@ -66,6 +66,9 @@ public:
 
 	FGLTFJsonNodeIndex GetComponentNodeIndex(FGLTFJsonNodeIndex NodeIndex);
 
+	// Returns the node that the mesh was assigned to, which is a new child node if the mesh positions need dequantization.
+	FGLTFJsonNodeIndex SetNodeMesh(FGLTFJsonNodeIndex NodeIndex, FGLTFJsonMeshIndex MeshIndex);
+
 private:
 
 	FString GetGeneratorString() const;
@@ -19,23 +19,25 @@ void FGLTFTaskBuilder::CompleteAllTasks(FFeedbackContext* Context)
 		const EGLTFTaskPriority Priority = static_cast<EGLTFTaskPriority>(PriorityIndex);
 
 		TArray<TUniquePtr<FGLTFTask>>* Tasks = TasksByPriority.Find(Priority);
-		if (Tasks == nullptr)
+		if (Tasks != nullptr)
 		{
-			continue;
-		}
+			const FText MessageFormat = GetPriorityMessageFormat(Priority);
+			FScopedSlowTask Progress(Tasks->Num(), FText::Format(MessageFormat, FText()), true, *Context);
+			Progress.MakeDialog();
 
-		const FText MessageFormat = GetPriorityMessageFormat(Priority);
-		FScopedSlowTask Progress(Tasks->Num(), FText::Format(MessageFormat, FText()), true, *Context);
-		Progress.MakeDialog();
+			for (TUniquePtr<FGLTFTask>& Task : *Tasks)
+			{
+				const FText Name = FText::FromString(Task->GetName());
+				const FText Message = FText::Format(MessageFormat, Name);
+				Progress.EnterProgressFrame(1, Message);
 
-		for (TUniquePtr<FGLTFTask>& Task : *Tasks)
-		{
-			const FText Name = FText::FromString(Task->GetName());
-			const FText Message = FText::Format(MessageFormat, Name);
-			Progress.EnterProgressFrame(1, Message);
+				Task->Complete();
+			}
 
-			Task->Complete();
+			TasksByPriority.Remove(Priority);
 		}
+
+		OnTasksCompleted(Priority);
 	}
 
 	TasksByPriority.Empty();
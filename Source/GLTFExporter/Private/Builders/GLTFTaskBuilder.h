@@ -29,6 +29,11 @@ public:
 
 	void CompleteAllTasks(FFeedbackContext* Context = GWarn);
 
+protected:
+
+	// Called once all tasks of the given priority have completed, after which no more tasks of the same (or higher) priority can be set up
+	virtual void OnTasksCompleted(EGLTFTaskPriority Priority) { }
+
 private:
 
 	static FText GetPriorityMessageFormat(EGLTFTaskPriority Priority);
@@ -2,8 +2,10 @@
 
 #include "Converters/GLTFAccessorConverters.h"
 #include "Converters/GLTFConverterUtility.h"
-#include "Converters/GLTFSkinWeightVertexBufferHack.h"
 #include "Builders/GLTFConvertBuilder.h"
+#include "Animation/MorphTarget.h"
+#include "Algo/MaxElement.h"
+#include "Algo/BinarySearch.h"
 
 // TODO: Unreal-style implementation of std::conditional to avoid mixing in STL. Should be added to the engine.
 template <bool Condition, class TypeIfTrue, class TypeIfFalse>
@@ -20,6 +22,130 @@ public:
 	typedef TypeIfTrue Type;
 };
 
+namespace
+{
+	template <typename GetDeltaFunctionType>
+	FGLTFJsonAccessorIndex ConvertMorphTargetDeltas(FGLTFConvertBuilder& Builder, const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex, bool bWriteMinMax, GetDeltaFunctionType GetDelta)
+	{
+		const TArray<uint32>& IndexMap = MeshSection->IndexMap;
+		const uint32 VertexCount = IndexMap.Num();
+
+		if (VertexCount == 0)
+		{
+			return FGLTFJsonAccessorIndex(INDEX_NONE);
+		}
+
+		// NOTE: a target without deltas for this LOD still gets an accessor (of only zeros), since every target needs at least one attribute
+		TMap<uint32, const FMorphTargetDelta*> DeltaLookup;
+
+		if (MorphTarget->MorphLODModels.IsValidIndex(LODIndex))
+		{
+			const TArray<FMorphTargetDelta>& Deltas = MorphTarget->MorphLODModels[LODIndex].Vertices;
+			DeltaLookup.Reserve(Deltas.Num());
+
+			for (const FMorphTargetDelta& Delta : Deltas)
+			{
+				DeltaLookup.Add(Delta.SourceIdx, &Delta);
+			}
+		}
+
+		// Vertices are visited in order, giving the strictly increasing indices required by sparse accessors
+		TArray<uint32> SparseIndices;
+		TArray<FGLTFVector3> SparseValues;
+
+		for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+		{
+			const FMorphTargetDelta* const* Delta = DeltaLookup.Find(IndexMap[VertexIndex]);
+			if (Delta == nullptr)
+			{
+				continue;
+			}
+
+			const FGLTFVector3 Value = GetDelta(**Delta);
+			if (!FVector(Value.X, Value.Y, Value.Z).IsNearlyZero())
+			{
+				SparseIndices.Add(VertexIndex);
+				SparseValues.Add(Value);
+			}
+		}
+
+		FGLTFJsonAccessor JsonAccessor;
+		JsonAccessor.ComponentType = EGLTFJsonComponentType::F32;
+		JsonAccessor.Count = VertexCount;
+		JsonAccessor.Type = EGLTFJsonAccessorType::Vec3;
+
+		if (bWriteMinMax)
+		{
+			// Bounds must also account for the vertices that are left at zero
+			const bool bHasZeroValues = SparseValues.Num() < static_cast<int32>(VertexCount);
+			JsonAccessor.MinMaxLength = 3;
+
+			for (int32 ComponentIndex = 0; ComponentIndex < JsonAccessor.MinMaxLength; ComponentIndex++)
+			{
+				float MinValue = bHasZeroValues ? 0.0f : SparseValues[0].Components[ComponentIndex];
+				float MaxValue = MinValue;
+
+				for (const FGLTFVector3& Value : SparseValues)
+				{
+					MinValue = FMath::Min(MinValue, Value.Components[ComponentIndex]);
+					MaxValue = FMath::Max(MaxValue, Value.Components[ComponentIndex]);
+				}
+
+				JsonAccessor.Min[ComponentIndex] = MinValue;
+				JsonAccessor.Max[ComponentIndex] = MaxValue;
+			}
+		}
+
+		if (SparseValues.Num() == 0)
+		{
+			// An accessor without buffer view is initialized with zeros
+			return Builder.AddAccessor(JsonAccessor);
+		}
+
+		const bool bShortIndices = VertexCount - 1 <= UINT16_MAX;
+		const uint64 SparseByteLength = SparseValues.Num() * ((bShortIndices ? sizeof(uint16) : sizeof(uint32)) + sizeof(FGLTFVector3));
+		const uint64 DenseByteLength = VertexCount * sizeof(FGLTFVector3);
+
+		if (SparseByteLength >= DenseByteLength)
+		{
+			TArray<FGLTFVector3> Values;
+			Values.AddZeroed(VertexCount);
+
+			for (int32 SparseIndex = 0; SparseIndex < SparseIndices.Num(); ++SparseIndex)
+			{
+				Values[SparseIndices[SparseIndex]] = SparseValues[SparseIndex];
+			}
+
+			JsonAccessor.BufferView = Builder.AddBufferView(Values, EGLTFJsonBufferTarget::ArrayBuffer);
+			return Builder.AddAccessor(JsonAccessor);
+		}
+
+		if (bShortIndices)
+		{
+			TArray<uint16> ShortIndices;
+			ShortIndices.AddUninitialized(SparseIndices.Num());
+
+			for (int32 SparseIndex = 0; SparseIndex < SparseIndices.Num(); ++SparseIndex)
+			{
+				ShortIndices[SparseIndex] = static_cast<uint16>(SparseIndices[SparseIndex]);
+			}
+
+			JsonAccessor.SparseIndices = Builder.AddBufferView(ShortIndices);
+			JsonAccessor.SparseIndexComponentType = EGLTFJsonComponentType::U16;
+		}
+		else
+		{
+			JsonAccessor.SparseIndices = Builder.AddBufferView(SparseIndices);
+			JsonAccessor.SparseIndexComponentType = EGLTFJsonComponentType::U32;
+		}
+
+		JsonAccessor.SparseCount = SparseValues.Num();
+		JsonAccessor.SparseValues = Builder.AddBufferView(SparseValues);
+
+		return Builder.AddAccessor(JsonAccessor);
+	}
+}
+
 FGLTFJsonAccessorIndex FGLTFPositionBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer)
 {
 	if (VertexBuffer == nullptr || VertexBuffer->GetNumVertices() == 0)
@@ -70,6 +196,66 @@ FGLTFJsonAccessorIndex FGLTFPositionBufferConverter::Convert(const FGLTFMeshSect
 	return Builder.AddAccessor(JsonAccessor);
 }
 
+FGLTFJsonAccessorIndex FGLTFQuantizedPositionBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer)
+{
+	if (VertexBuffer == nullptr || VertexBuffer->GetNumVertices() == 0)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	const FGLTFPositionQuantization Quantization = Builder.GetOrAddPositionQuantization(VertexBuffer);
+	if (!Quantization.bIsValid)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	Builder.AddExtension(EGLTFJsonExtension::KHR_MeshQuantization, true);
+
+	const TArray<uint32>& IndexMap = MeshSection->IndexMap;
+	const uint32 VertexCount = IndexMap.Num();
+
+	TArray<FGLTFInt16Vector4> Positions;
+	Positions.AddUninitialized(VertexCount);
+
+	for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		const uint32 MappedVertexIndex = IndexMap[VertexIndex];
+		Positions[VertexIndex] = Quantization.Quantize(FGLTFConverterUtility::ConvertPosition(VertexBuffer->VertexPosition(MappedVertexIndex), Builder.ExportOptions->ExportUniformScale));
+	}
+
+	FGLTFJsonAccessor JsonAccessor;
+	JsonAccessor.BufferView = Builder.AddBufferView(Positions, EGLTFJsonBufferTarget::ArrayBuffer);
+	JsonAccessor.ComponentType = EGLTFJsonComponentType::S16;
+	JsonAccessor.Count = VertexCount;
+	JsonAccessor.Type = EGLTFJsonAccessorType::Vec3;
+	JsonAccessor.bNormalized = true;
+
+	Builder.GetBufferView(JsonAccessor.BufferView).ByteStride = sizeof(FGLTFInt16Vector4);
+
+	if (VertexCount > 0)
+	{
+		// Bounding box uses the raw quantized values, since min / max must match the stored components (even when normalized)
+		JsonAccessor.MinMaxLength = 3;
+
+		for (int32 ComponentIndex = 0; ComponentIndex < JsonAccessor.MinMaxLength; ComponentIndex++)
+		{
+			int16 MinValue = Positions[0].Components[ComponentIndex];
+			int16 MaxValue = Positions[0].Components[ComponentIndex];
+
+			for (uint32 VertexIndex = 1; VertexIndex < VertexCount; ++VertexIndex)
+			{
+				MinValue = FMath::Min(MinValue, Positions[VertexIndex].Components[ComponentIndex]);
+				MaxValue = FMath::Max(MaxValue, Positions[VertexIndex].Components[ComponentIndex]);
+			}
+
+			JsonAccessor.Min[ComponentIndex] = MinValue;
+			JsonAccessor.Max[ComponentIndex] = MaxValue;
+		}
+	}
+
+	return Builder.AddAccessor(JsonAccessor);
+}
+
 FGLTFJsonAccessorIndex FGLTFColorBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FColorVertexBuffer* VertexBuffer)
 {
 	if (VertexBuffer == nullptr || VertexBuffer->GetNumVertices() == 0)
@@ -284,38 +470,94 @@ FGLTFJsonAccessorIndex FGLTFUVBufferConverter::Convert(const FGLTFMeshSection* M
 	}
 
 	FGLTFJsonAccessor JsonAccessor;
-	JsonAccessor.BufferView = Builder.AddBufferView(UVs, EGLTFJsonBufferTarget::ArrayBuffer);
 	JsonAccessor.ComponentType = EGLTFJsonComponentType::F32;
 	JsonAccessor.Count = VertexCount;
 	JsonAccessor.Type = EGLTFJsonAccessorType::Vec2;
 
+	const float QuantizationTolerance = Builder.ExportOptions->bUseMeshQuantization ? Builder.ExportOptions->TexCoordQuantizationTolerance : 0;
+	if (QuantizationTolerance > 0 && VertexCount > 0)
+	{
+		float MinValue = UVs[0].X;
+		float MaxValue = UVs[0].X;
+
+		for (const FGLTFVector2& UV : UVs)
+		{
+			MinValue = FMath::Min3(MinValue, UV.X, UV.Y);
+			MaxValue = FMath::Max3(MaxValue, UV.X, UV.Y);
+		}
+
+		// Rounding to the nearest step of a normalized integer gives a maximum error of half a step
+		if (MinValue >= 0 && MaxValue <= 1 && 0.5f / UINT16_MAX <= QuantizationTolerance)
+		{
+			JsonAccessor.ComponentType = EGLTFJsonComponentType::U16;
+			JsonAccessor.BufferView = ConvertQuantizedBufferView<uint16>(UVs);
+		}
+		else if (MinValue >= -1 && MaxValue <= 1 && 0.5f / INT16_MAX <= QuantizationTolerance)
+		{
+			JsonAccessor.ComponentType = EGLTFJsonComponentType::S16;
+			JsonAccessor.BufferView = ConvertQuantizedBufferView<int16>(UVs);
+		}
+	}
+
+	if (JsonAccessor.ComponentType == EGLTFJsonComponentType::F32)
+	{
+		JsonAccessor.BufferView = Builder.AddBufferView(UVs, EGLTFJsonBufferTarget::ArrayBuffer);
+	}
+	else
+	{
+		Builder.AddExtension(EGLTFJsonExtension::KHR_MeshQuantization, true);
+		JsonAccessor.bNormalized = true;
+	}
+
 	return Builder.AddAccessor(JsonAccessor);
 }
 
-FGLTFJsonAccessorIndex FGLTFBoneIndexBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset)
+template <typename ComponentType>
+FGLTFJsonBufferViewIndex FGLTFUVBufferConverter::ConvertQuantizedBufferView(const TArray<FGLTFVector2>& UVs)
 {
-	return MeshSection->MaxBoneIndex <= UINT8_MAX
-		? Convert<uint8>(MeshSection, VertexBuffer, InfluenceOffset)
-		: Convert<uint16>(MeshSection, VertexBuffer, InfluenceOffset);
+	const int32 VertexCount = UVs.Num();
+	const float MaxValue = TNumericLimits<ComponentType>::Max();
+
+	TArray<TGLTFVector2<ComponentType>> QuantizedUVs;
+	QuantizedUVs.AddUninitialized(VertexCount);
+
+	for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		QuantizedUVs[VertexIndex].X = static_cast<ComponentType>(FMath::RoundToInt(UVs[VertexIndex].X * MaxValue));
+		QuantizedUVs[VertexIndex].Y = static_cast<ComponentType>(FMath::RoundToInt(UVs[VertexIndex].Y * MaxValue));
+	}
+
+	return Builder.AddBufferView(QuantizedUVs, EGLTFJsonBufferTarget::ArrayBuffer);
+}
+
+FGLTFJsonAccessorIndex FGLTFBoneIndexBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset, const FGLTFSkinJoints* SkinJoints)
+{
+	// Joint indices increase with bone indices, so the section can't refer to more joints than there are joint bones up to its largest bone index
+	const int32 MaxJointIndex = Algo::UpperBound(SkinJoints->Bones, MeshSection->MaxBoneIndex) - 1;
+
+	return MaxJointIndex <= UINT8_MAX
+		? Convert<uint8>(MeshSection, VertexBuffer, InfluenceOffset, SkinJoints)
+		: Convert<uint16>(MeshSection, VertexBuffer, InfluenceOffset, SkinJoints);
 }
 
 template <typename IndexType>
-FGLTFJsonAccessorIndex FGLTFBoneIndexBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset) const
+FGLTFJsonAccessorIndex FGLTFBoneIndexBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset, const FGLTFSkinJoints* SkinJoints) const
 {
 	if (VertexBuffer == nullptr || VertexBuffer->GetNumVertices() == 0)
 	{
 		return FGLTFJsonAccessorIndex(INDEX_NONE);
 	}
 
-	const uint32 InfluenceCount = VertexBuffer->GetMaxBoneInfluences();
+	const FGLTFSkinWeights* SkinWeights = Builder.GetOrAddSkinWeights(MeshSection, VertexBuffer);
+	const uint32 InfluenceCount = SkinWeights->InfluenceCount;
 	if (InfluenceOffset >= InfluenceCount)
 	{
 		// TODO: report warning
 		return FGLTFJsonAccessorIndex(INDEX_NONE);
 	}
 
-	const TArray<uint32>& IndexMap = MeshSection->IndexMap;
-	const uint32 VertexCount = IndexMap.Num();
+	const uint32 VertexCount = MeshSection->IndexMap.Num();
+	const TArray<int32>& JointIndices = SkinJoints->JointIndices;
 
 	struct VertexBoneIndices
 	{
@@ -327,15 +569,15 @@ FGLTFJsonAccessorIndex FGLTFBoneIndexBufferConverter::Convert(const FGLTFMeshSec
 
 	for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
 	{
-		const TArray<FBoneIndexType>& BoneMap = MeshSection->BoneMaps[MeshSection->BoneMapLookup[VertexIndex]];
-		const uint32 MappedVertexIndex = IndexMap[VertexIndex];
+		const FBoneIndexType* VertexJoints = &SkinWeights->Joints[VertexIndex * InfluenceCount + InfluenceOffset];
 		VertexBoneIndices& VertexBones = BoneIndices[VertexIndex];
 
 		for (int32 InfluenceIndex = 0; InfluenceIndex < 4; ++InfluenceIndex)
 		{
-			// TODO: remove hack
-			const uint32 UnmappedBoneIndex = FGLTFSkinWeightVertexBufferHack(VertexBuffer).GetBoneIndex(MappedVertexIndex, InfluenceOffset + InfluenceIndex);
-			VertexBones.Index[InfluenceIndex] = static_cast<IndexType>(BoneMap[UnmappedBoneIndex]);
+			// Bones missing from the joints (stripped, or outside the palette of a split mesh) only occur in unused influences, which have zero weight
+			// and may refer to any joint, so they are simply mapped to the first joint. Triangles no palette fully contains are never exported.
+			const int32 JointIndex = JointIndices.IsValidIndex(VertexJoints[InfluenceIndex]) ? JointIndices[VertexJoints[InfluenceIndex]] : INDEX_NONE;
+			VertexBones.Index[InfluenceIndex] = static_cast<IndexType>(FMath::Max(JointIndex, 0));
 		}
 	}
 
@@ -355,15 +597,15 @@ FGLTFJsonAccessorIndex FGLTFBoneWeightBufferConverter::Convert(const FGLTFMeshSe
 		return FGLTFJsonAccessorIndex(INDEX_NONE);
 	}
 
-	const uint32 InfluenceCount = VertexBuffer->GetMaxBoneInfluences();
+	const FGLTFSkinWeights* SkinWeights = Builder.GetOrAddSkinWeights(MeshSection, VertexBuffer);
+	const uint32 InfluenceCount = SkinWeights->InfluenceCount;
 	if (InfluenceOffset >= InfluenceCount)
 	{
 		// TODO: report warning
 		return FGLTFJsonAccessorIndex(INDEX_NONE);
 	}
 
-	const TArray<uint32>& IndexMap = MeshSection->IndexMap;
-	const uint32 VertexCount = IndexMap.Num();
+	const uint32 VertexCount = MeshSection->IndexMap.Num();
 
 	struct VertexBoneWeights
 	{
@@ -375,15 +617,7 @@ FGLTFJsonAccessorIndex FGLTFBoneWeightBufferConverter::Convert(const FGLTFMeshSe
 
 	for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
 	{
-		const uint32 MappedVertexIndex = IndexMap[VertexIndex];
-		VertexBoneWeights& VertexWeights = BoneWeights[VertexIndex];
-
-		for (uint32 InfluenceIndex = 0; InfluenceIndex < 4; ++InfluenceIndex)
-		{
-			// TODO: remove hack
-			const uint8 BoneWeight = FGLTFSkinWeightVertexBufferHack(VertexBuffer).GetBoneWeight(MappedVertexIndex, InfluenceOffset + InfluenceIndex);
-			VertexWeights.Weights[InfluenceIndex] = BoneWeight;
-		}
+		FMemory::Memcpy(BoneWeights[VertexIndex].Weights, &SkinWeights->Weights[VertexIndex * InfluenceCount + InfluenceOffset], 4);
 	}
 
 	FGLTFJsonAccessor JsonAccessor;
@@ -396,9 +630,29 @@ FGLTFJsonAccessorIndex FGLTFBoneWeightBufferConverter::Convert(const FGLTFMeshSe
 	return Builder.AddAccessor(JsonAccessor);
 }
 
+FGLTFJsonAccessorIndex FGLTFMorphTargetPositionBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex)
+{
+	const float ExportScale = Builder.ExportOptions->ExportUniformScale;
+
+	// Position deltas of morph targets are required to have bounds
+	return ConvertMorphTargetDeltas(Builder, MeshSection, MorphTarget, LODIndex, true, [ExportScale](const FMorphTargetDelta& Delta)
+	{
+		return FGLTFConverterUtility::ConvertPosition(Delta.PositionDelta, ExportScale);
+	});
+}
+
+FGLTFJsonAccessorIndex FGLTFMorphTargetNormalBufferConverter::Convert(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex)
+{
+	return ConvertMorphTargetDeltas(Builder, MeshSection, MorphTarget, LODIndex, false, [](const FMorphTargetDelta& Delta)
+	{
+		return FGLTFConverterUtility::ConvertNormal(Delta.TangentZDelta);
+	});
+}
+
 FGLTFJsonAccessorIndex FGLTFIndexBufferConverter::Convert(const FGLTFMeshSection* MeshSection)
 {
-	const uint32 MaxVertexIndex = MeshSection->IndexMap.Num() - 1;
+	const uint32* MaxElement = Algo::MaxElement(MeshSection->IndexBuffer);
+	const uint32 MaxVertexIndex = MaxElement != nullptr ? *MaxElement : 0;
 	if (MaxVertexIndex <= UINT8_MAX) return Convert<uint8>(MeshSection);
 	if (MaxVertexIndex <= UINT16_MAX) return Convert<uint16>(MeshSection);
 	return Convert<uint32>(MeshSection);
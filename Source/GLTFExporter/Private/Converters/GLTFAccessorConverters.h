@@ -6,6 +6,7 @@
 #include "Converters/GLTFConverter.h"
 #include "Converters/GLTFBuilderContext.h"
 #include "Converters/GLTFMeshSection.h"
+#include "Converters/GLTFSkinConverters.h"
 #include "Engine.h"
 
 template <typename... InputTypes>
@@ -21,6 +22,13 @@ class FGLTFPositionBufferConverter final : public TGLTFAccessorConverter<const F
 	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer) override;
 };
 
+class FGLTFQuantizedPositionBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const FPositionVertexBuffer*>
+{
+	using TGLTFAccessorConverter::TGLTFAccessorConverter;
+
+	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* VertexBuffer) override;
+};
+
 class FGLTFColorBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const FColorVertexBuffer*>
 {
 	using TGLTFAccessorConverter::TGLTFAccessorConverter;
@@ -53,16 +61,19 @@ class FGLTFUVBufferConverter final : public TGLTFAccessorConverter<const FGLTFMe
 	using TGLTFAccessorConverter::TGLTFAccessorConverter;
 
 	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FStaticMeshVertexBuffer* VertexBuffer, uint32 UVIndex) override;
+
+	template <typename ComponentType>
+	FGLTFJsonBufferViewIndex ConvertQuantizedBufferView(const TArray<FGLTFVector2>& UVs);
 };
 
-class FGLTFBoneIndexBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const FSkinWeightVertexBuffer*, uint32>
+class FGLTFBoneIndexBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const FSkinWeightVertexBuffer*, uint32, const FGLTFSkinJoints*>
 {
 	using TGLTFAccessorConverter::TGLTFAccessorConverter;
 
-	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset) override;
+	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset, const FGLTFSkinJoints* SkinJoints) override;
 
 	template <typename IndexType>
-	FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset) const;
+	FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset, const FGLTFSkinJoints* SkinJoints) const;
 };
 
 class FGLTFBoneWeightBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const FSkinWeightVertexBuffer*, uint32>
@@ -72,6 +83,20 @@ class FGLTFBoneWeightBufferConverter final : public TGLTFAccessorConverter<const
 	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer, uint32 InfluenceOffset) override;
 };
 
+class FGLTFMorphTargetPositionBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const UMorphTarget*, int32>
+{
+	using TGLTFAccessorConverter::TGLTFAccessorConverter;
+
+	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex) override;
+};
+
+class FGLTFMorphTargetNormalBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*, const UMorphTarget*, int32>
+{
+	using TGLTFAccessorConverter::TGLTFAccessorConverter;
+
+	virtual FGLTFJsonAccessorIndex Convert(const FGLTFMeshSection* MeshSection, const UMorphTarget* MorphTarget, int32 LODIndex) override;
+};
+
 class FGLTFIndexBufferConverter final : public TGLTFAccessorConverter<const FGLTFMeshSection*>
 {
 	using TGLTFAccessorConverter::TGLTFAccessorConverter;
@@ -9,6 +9,16 @@ bool FGLTFActorUtility::IsRootActor(const AActor* Actor, bool bSelectedOnly)
 	return ParentActor == nullptr || (bSelectedOnly && !ParentActor->IsSelected());
 }
 
+const AActor* FGLTFActorUtility::GetRootActor(const AActor* Actor, bool bSelectedOnly)
+{
+	while (!IsRootActor(Actor, bSelectedOnly))
+	{
+		Actor = Actor->GetAttachParentActor();
+	}
+
+	return Actor;
+}
+
 UBlueprint* FGLTFActorUtility::GetBlueprintFromActor(const AActor* Actor)
 {
 	return UBlueprint::GetBlueprintFromClass(Actor->GetClass());
@@ -8,6 +8,8 @@ struct FGLTFActorUtility
 {
 	static bool IsRootActor(const AActor* Actor, bool bSelectedOnly);
 
+	static const AActor* GetRootActor(const AActor* Actor, bool bSelectedOnly);
+
 	static UBlueprint* GetBlueprintFromActor(const AActor* Actor);
 
 	static bool IsSkySphereBlueprint(const UBlueprint* Blueprint);
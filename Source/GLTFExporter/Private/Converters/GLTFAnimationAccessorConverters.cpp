@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFAnimationAccessorConverters.h"
+#include "Builders/GLTFConvertBuilder.h"
+
+namespace
+{
+	template <typename ValueType>
+	FGLTFJsonAccessorIndex ConvertOutput(FGLTFConvertBuilder& Builder, TArrayView<const ValueType> Values, EGLTFJsonAccessorType Type)
+	{
+		if (Values.Num() == 0)
+		{
+			return FGLTFJsonAccessorIndex(INDEX_NONE);
+		}
+
+		FGLTFJsonAccessor JsonAccessor;
+		JsonAccessor.BufferView = Builder.AddBufferView(Values.GetData(), Values.Num() * sizeof(ValueType));
+		JsonAccessor.ComponentType = EGLTFJsonComponentType::F32;
+		JsonAccessor.Count = Values.Num();
+		JsonAccessor.Type = Type;
+
+		return Builder.AddAccessor(JsonAccessor);
+	}
+}
+
+FGLTFJsonAccessorIndex FGLTFAnimationInputConverter::Convert(TArrayView<const float> Timestamps)
+{
+	if (Timestamps.Num() == 0)
+	{
+		return FGLTFJsonAccessorIndex(INDEX_NONE);
+	}
+
+	FGLTFJsonAccessor JsonAccessor;
+	JsonAccessor.BufferView = Builder.AddBufferView(Timestamps.GetData(), Timestamps.Num() * sizeof(float));
+	JsonAccessor.ComponentType = EGLTFJsonComponentType::F32;
+	JsonAccessor.Type = EGLTFJsonAccessorType::Scalar;
+	JsonAccessor.Count = Timestamps.Num();
+	JsonAccessor.MinMaxLength = 1;
+	JsonAccessor.Min[0] = Timestamps[0];
+	JsonAccessor.Max[0] = Timestamps.Last();
+
+	return Builder.AddAccessor(JsonAccessor);
+}
+
+FGLTFJsonAccessorIndex FGLTFAnimationVector3OutputConverter::Convert(TArrayView<const FGLTFVector3> Values)
+{
+	return ConvertOutput(Builder, Values, EGLTFJsonAccessorType::Vec3);
+}
+
+FGLTFJsonAccessorIndex FGLTFAnimationQuaternionOutputConverter::Convert(TArrayView<const FGLTFQuaternion> Values)
+{
+	const float QuantizationTolerance = Builder.ExportOptions->bUseAnimationQuantization ? FMath::DegreesToRadians(Builder.ExportOptions->RotationQuantizationTolerance) : 0;
+	if (QuantizationTolerance > 0 && Values.Num() > 0)
+	{
+		// Unlike translations and scales, glTF allows rotation outputs to be normalized integers (without requiring any extension)
+
+		TArray<FGLTFInt8Vector4> Int8Rotations;
+		if (QuantizeRotations(Values, QuantizationTolerance, Int8Rotations))
+		{
+			FGLTFJsonAccessor JsonAccessor;
+			JsonAccessor.BufferView = Builder.AddBufferView(Int8Rotations);
+			JsonAccessor.ComponentType = EGLTFJsonComponentType::S8;
+			JsonAccessor.Count = Values.Num();
+			JsonAccessor.Type = EGLTFJsonAccessorType::Vec4;
+			JsonAccessor.bNormalized = true;
+			return Builder.AddAccessor(JsonAccessor);
+		}
+
+		TArray<FGLTFInt16Vector4> Int16Rotations;
+		if (QuantizeRotations(Values, QuantizationTolerance, Int16Rotations))
+		{
+			FGLTFJsonAccessor JsonAccessor;
+			JsonAccessor.BufferView = Builder.AddBufferView(Int16Rotations);
+			JsonAccessor.ComponentType = EGLTFJsonComponentType::S16;
+			JsonAccessor.Count = Values.Num();
+			JsonAccessor.Type = EGLTFJsonAccessorType::Vec4;
+			JsonAccessor.bNormalized = true;
+			return Builder.AddAccessor(JsonAccessor);
+		}
+	}
+
+	return ConvertOutput(Builder, Values, EGLTFJsonAccessorType::Vec4);
+}
+
+template <typename ComponentType>
+bool FGLTFAnimationQuaternionOutputConverter::QuantizeRotations(TArrayView<const FGLTFQuaternion> Rotations, float Tolerance, TArray<TGLTFVector4<ComponentType>>& OutQuantizedRotations)
+{
+	const float MaxValue = TNumericLimits<ComponentType>::Max();
+
+	OutQuantizedRotations.AddUninitialized(Rotations.Num());
+
+	for (int32 Index = 0; Index < Rotations.Num(); ++Index)
+	{
+		const FGLTFQuaternion& Rotation = Rotations[Index];
+		TGLTFVector4<ComponentType>& QuantizedRotation = OutQuantizedRotations[Index];
+		float Dequantized[4];
+
+		for (int32 ComponentIndex = 0; ComponentIndex < 4; ++ComponentIndex)
+		{
+			const int32 QuantizedValue = FMath::Clamp(FMath::RoundToInt(Rotation.Components[ComponentIndex] * MaxValue), -static_cast<int32>(MaxValue), static_cast<int32>(MaxValue));
+			QuantizedRotation.Components[ComponentIndex] = static_cast<ComponentType>(QuantizedValue);
+			Dequantized[ComponentIndex] = QuantizedValue / MaxValue;
+		}
+
+		// Compare the rotation a viewer will reconstruct (i.e. after normalizing) against the full precision reference
+		const FQuat Reference(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+		const FQuat Reconstructed = FQuat(Dequantized[0], Dequantized[1], Dequantized[2], Dequantized[3]).GetNormalized();
+
+		if (Reference.AngularDistance(Reconstructed) > Tolerance)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
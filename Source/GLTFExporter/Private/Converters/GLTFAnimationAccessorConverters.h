@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Core/GLTFVector.h"
+#include "Core/GLTFQuaternion.h"
+#include "Json/GLTFJsonIndex.h"
+#include "Builders/GLTFBinaryHashKey.h"
+#include "Converters/GLTFBuilderContext.h"
+#include "Engine.h"
+
+// Unlike other converters, animation data is looked up by content (rather than by source object), since identical timestamps
+// and tracks are common across the animations of the same skeleton and level sequences sampled at the same rate
+template <typename ValueType>
+class TGLTFAnimationAccessorConverter : public FGLTFBuilderContext
+{
+public:
+
+	using FGLTFBuilderContext::FGLTFBuilderContext;
+
+	virtual ~TGLTFAnimationAccessorConverter() = default;
+
+	FGLTFJsonAccessorIndex GetOrAdd(TArrayView<const ValueType> Values)
+	{
+		const FGLTFBinaryHashKey HashKey(Values.GetData(), Values.Num() * sizeof(ValueType));
+		if (const FGLTFJsonAccessorIndex* SavedOutput = SavedOutputs.Find(HashKey))
+		{
+			return *SavedOutput;
+		}
+
+		const FGLTFJsonAccessorIndex NewOutput = Convert(Values);
+
+		SavedOutputs.Add(HashKey, NewOutput);
+		return NewOutput;
+	}
+
+protected:
+
+	virtual FGLTFJsonAccessorIndex Convert(TArrayView<const ValueType> Values) = 0;
+
+private:
+
+	TMap<FGLTFBinaryHashKey, FGLTFJsonAccessorIndex> SavedOutputs;
+};
+
+class FGLTFAnimationInputConverter final : public TGLTFAnimationAccessorConverter<float>
+{
+	using TGLTFAnimationAccessorConverter::TGLTFAnimationAccessorConverter;
+
+	virtual FGLTFJsonAccessorIndex Convert(TArrayView<const float> Timestamps) override;
+};
+
+class FGLTFAnimationVector3OutputConverter final : public TGLTFAnimationAccessorConverter<FGLTFVector3>
+{
+	using TGLTFAnimationAccessorConverter::TGLTFAnimationAccessorConverter;
+
+	virtual FGLTFJsonAccessorIndex Convert(TArrayView<const FGLTFVector3> Values) override;
+};
+
+class FGLTFAnimationQuaternionOutputConverter final : public TGLTFAnimationAccessorConverter<FGLTFQuaternion>
+{
+	using TGLTFAnimationAccessorConverter::TGLTFAnimationAccessorConverter;
+
+	virtual FGLTFJsonAccessorIndex Convert(TArrayView<const FGLTFQuaternion> Values) override;
+
+	template <typename ComponentType>
+	static bool QuantizeRotations(TArrayView<const FGLTFQuaternion> Rotations, float Tolerance, TArray<TGLTFVector4<ComponentType>>& OutQuantizedRotations);
+};
@@ -20,6 +20,49 @@ FTransform FGLTFBoneUtility::GetBindTransform(const FReferenceSkeleton& RefSkele
 	return BindTransform;
 }
 
+TArray<FTransform> FGLTFBoneUtility::GetBindTransforms(const FReferenceSkeleton& RefSkeleton)
+{
+	const TArray<FMeshBoneInfo>& BoneInfos = RefSkeleton.GetRefBoneInfo();
+	const TArray<FTransform>& BonePoses = RefSkeleton.GetRefBonePose();
+
+	TArray<FTransform> BindTransforms;
+	BindTransforms.AddUninitialized(BonePoses.Num());
+
+	// Parents always precede their children in a reference skeleton
+	for (int32 BoneIndex = 0; BoneIndex < BonePoses.Num(); ++BoneIndex)
+	{
+		const int32 ParentIndex = BoneInfos[BoneIndex].ParentIndex;
+		BindTransforms[BoneIndex] = ParentIndex != INDEX_NONE ? BonePoses[BoneIndex] * BindTransforms[ParentIndex] : BonePoses[BoneIndex];
+	}
+
+	return BindTransforms;
+}
+
+bool FGLTFBoneUtility::IsSameSkeleton(const FReferenceSkeleton& RefSkeletonA, const FReferenceSkeleton& RefSkeletonB)
+{
+	const TArray<FMeshBoneInfo>& BoneInfosA = RefSkeletonA.GetRefBoneInfo();
+	const TArray<FMeshBoneInfo>& BoneInfosB = RefSkeletonB.GetRefBoneInfo();
+	const TArray<FTransform>& BonePosesA = RefSkeletonA.GetRefBonePose();
+	const TArray<FTransform>& BonePosesB = RefSkeletonB.GetRefBonePose();
+
+	if (BoneInfosA.Num() != BoneInfosB.Num())
+	{
+		return false;
+	}
+
+	for (int32 BoneIndex = 0; BoneIndex < BoneInfosA.Num(); ++BoneIndex)
+	{
+		if (BoneInfosA[BoneIndex].Name != BoneInfosB[BoneIndex].Name ||
+			BoneInfosA[BoneIndex].ParentIndex != BoneInfosB[BoneIndex].ParentIndex ||
+			!BonePosesA[BoneIndex].Equals(BonePosesB[BoneIndex]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void FGLTFBoneUtility::InitializeToSkeleton(FBoneContainer& BoneContainer, const USkeleton* Skeleton)
 {
 	TArray<FBoneIndexType> RequiredBoneIndices;
@@ -8,6 +8,12 @@ struct FGLTFBoneUtility
 {
 	static FTransform GetBindTransform(const FReferenceSkeleton& RefSkeleton, int32 BoneIndex);
 
+	// Same as GetBindTransform for all bones, but in a single pass (by reusing the bind transform of each parent)
+	static TArray<FTransform> GetBindTransforms(const FReferenceSkeleton& RefSkeleton);
+
+	// Returns true if both reference skeletons have the same bones (in the same order) with the same hierarchy and reference pose
+	static bool IsSameSkeleton(const FReferenceSkeleton& RefSkeletonA, const FReferenceSkeleton& RefSkeletonB);
+
 	static void InitializeToSkeleton(FBoneContainer& BoneContainer, const USkeleton* Skeleton);
 
 	static void RetargetTransform(const UAnimSequence* AnimSequence, FTransform& BoneTransform, int32 SkeletonBoneIndex, int32 BoneIndex, const FBoneContainer& RequiredBones);
@@ -13,11 +13,11 @@ public:
 
 	virtual ~TGLTFConverter() = default;
 
-	OutputType Get(InputTypes&&... Inputs) const
+	OutputType Get(InputTypes... Inputs)
 	{
 		Sanitize(Inputs...);
-		const InputKeyType InputKey(Forward<InputTypes>(Inputs)...);
-		if (OutputType* SavedOutput = SavedOutputs.Find(InputKey))
+		const InputKeyType InputKey(Inputs...);
+		if (const OutputType* SavedOutput = SavedOutputs.Find(InputKey))
 		{
 			return *SavedOutput;
 		}
@@ -52,6 +52,12 @@ public:
 
 protected:
 
+	// Forgets all saved outputs, which means any subsequent request will be converted again
+	void ClearSavedOutputs()
+	{
+		SavedOutputs.Empty();
+	}
+
 	virtual void Sanitize(InputTypes&... Inputs) { }
 
 	virtual OutputType Convert(InputTypes... Inputs) = 0;
@@ -4,6 +4,55 @@
 #include "Converters/GLTFTextureUtility.h"
 #include "Actors/GLTFCameraActor.h"
 
+void FGLTFConverterUtility::ConvertPositions(TArrayView<const FVector> Positions, const float ConversionScale, TArrayView<FGLTFVector3> OutPositions)
+{
+	check(Positions.Num() == OutPositions.Num());
+
+	const VectorRegister Scale = VectorSetFloat1(ConversionScale);
+
+	for (int32 Index = 0; Index < Positions.Num(); ++Index)
+	{
+		// Same as ConvertPosition, i.e. swap Y and Z, and apply the uniform scale
+		const VectorRegister Position = VectorLoadFloat3(&Positions[Index]);
+		VectorStoreFloat3(VectorMultiply(VectorSwizzle(Position, 0, 2, 1, 3), Scale), &OutPositions[Index]);
+	}
+}
+
+void FGLTFConverterUtility::ConvertScales(TArrayView<const FVector> Scales, TArrayView<FGLTFVector3> OutScales)
+{
+	check(Scales.Num() == OutScales.Num());
+
+	for (int32 Index = 0; Index < Scales.Num(); ++Index)
+	{
+		const VectorRegister Scale = VectorLoadFloat3(&Scales[Index]);
+		VectorStoreFloat3(VectorSwizzle(Scale, 0, 2, 1, 3), &OutScales[Index]);
+	}
+}
+
+void FGLTFConverterUtility::ConvertRotations(TArrayView<const FQuat> Rotations, TArrayView<FGLTFQuaternion> OutRotations)
+{
+	check(Rotations.Num() == OutRotations.Num());
+
+	const VectorRegister HandednessFlip = MakeVectorRegister(-1.0f, -1.0f, -1.0f, 1.0f);
+
+	for (int32 Index = 0; Index < Rotations.Num(); ++Index)
+	{
+		// Same as ConvertRotation, i.e. normalize, swap Y and Z, and negate the imaginary part
+		const VectorRegister Rotation = VectorNormalizeQuaternion(VectorLoad(&Rotations[Index]));
+		VectorStore(VectorMultiply(VectorSwizzle(Rotation, 0, 2, 1, 3), HandednessFlip), &OutRotations[Index]);
+	}
+}
+
+void FGLTFConverterUtility::ConvertTransforms(TArrayView<const FTransform> Transforms, const float ConversionScale, TArrayView<FGLTFMatrix4> OutMatrices)
+{
+	check(Transforms.Num() == OutMatrices.Num());
+
+	for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+	{
+		OutMatrices[Index] = ConvertTransform(Transforms[Index], ConversionScale);
+	}
+}
+
 EGLTFJsonCameraType FGLTFConverterUtility::ConvertCameraType(ECameraProjectionMode::Type ProjectionMode)
 {
 	switch (ProjectionMode)
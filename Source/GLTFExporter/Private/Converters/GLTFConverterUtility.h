@@ -164,6 +164,12 @@ struct FGLTFConverterUtility
 		return ConvertMatrix(Matrix);
 	}
 
+	// Batch versions of the conversions above, for large arrays (e.g. animation keys and inverse bind matrices)
+	static void ConvertPositions(TArrayView<const FVector> Positions, const float ConversionScale, TArrayView<FGLTFVector3> OutPositions);
+	static void ConvertScales(TArrayView<const FVector> Scales, TArrayView<FGLTFVector3> OutScales);
+	static void ConvertRotations(TArrayView<const FQuat> Rotations, TArrayView<FGLTFQuaternion> OutRotations);
+	static void ConvertTransforms(TArrayView<const FTransform> Transforms, const float ConversionScale, TArrayView<FGLTFMatrix4> OutMatrices);
+
 	static float ConvertFieldOfView(float FOVInDegrees, float AspectRatio)
 	{
 		const float HorizontalFOV = FMath::DegreesToRadians(FOVInDegrees);
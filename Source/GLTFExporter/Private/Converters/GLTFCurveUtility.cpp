@@ -2,6 +2,7 @@
 
 #include "Converters/GLTFCurveUtility.h"
 #include "Curves/CurveLinearColor.h"
+#include "Channels/MovieSceneFloatChannel.h"
 
 bool FGLTFCurveUtility::HasAnyAdjustment(const UCurveLinearColor& ColorCurve, float Tolerance)
 {
@@ -13,3 +14,125 @@ bool FGLTFCurveUtility::HasAnyAdjustment(const UCurveLinearColor& ColorCurve, fl
 		|| !FMath::IsNearlyEqual(ColorCurve.AdjustMaxAlpha,        1, Tolerance)
 		|| !FMath::IsNearlyEqual(ColorCurve.AdjustMinAlpha,        0, Tolerance);
 }
+
+bool FGLTFCurveUtility::GetCubicSplineKeys(TArrayView<FMovieSceneFloatChannel*> Channels, FFrameNumber StartFrame, FFrameNumber EndFrame, FFrameRate TickResolution, TArray<float>& OutTimestamps, TArray<FVector>& OutValues)
+{
+	check(Channels.Num() == 3);
+
+	const FMovieSceneFloatChannel* KeyedChannel = nullptr;
+
+	for (const FMovieSceneFloatChannel* Channel : Channels)
+	{
+		if (Channel->GetNumKeys() == 0)
+		{
+			continue;
+		}
+
+		if (Channel->PreInfinityExtrap != RCCE_Constant || Channel->PostInfinityExtrap != RCCE_Constant)
+		{
+			return false;
+		}
+
+		const TArrayView<const FFrameNumber> Times = Channel->GetTimes();
+		const TArrayView<const FMovieSceneFloatValue> Values = Channel->GetValues();
+
+		for (int32 KeyIndex = 0; KeyIndex < Values.Num(); ++KeyIndex)
+		{
+			const FMovieSceneFloatValue& Value = Values[KeyIndex];
+
+			// The interpolation mode of the last key is never used
+			if (KeyIndex < Values.Num() - 1 && Value.InterpMode != RCIM_Linear && Value.InterpMode != RCIM_Cubic)
+			{
+				return false;
+			}
+
+			if (Value.Tangent.TangentWeightMode != RCTWM_WeightedNone)
+			{
+				return false;
+			}
+
+			if (Times[KeyIndex] < StartFrame || Times[KeyIndex] > EndFrame || (KeyIndex > 0 && Times[KeyIndex] <= Times[KeyIndex - 1]))
+			{
+				return false;
+			}
+		}
+
+		if (KeyedChannel == nullptr)
+		{
+			KeyedChannel = Channel;
+		}
+		else
+		{
+			const TArrayView<const FFrameNumber> KeyedTimes = KeyedChannel->GetTimes();
+			if (Times.Num() != KeyedTimes.Num() || FMemory::Memcmp(Times.GetData(), KeyedTimes.GetData(), Times.Num() * sizeof(FFrameNumber)) != 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	if (KeyedChannel == nullptr)
+	{
+		// Nothing to gain over a sampled (and thereby reducible) constant
+		return false;
+	}
+
+	const TArrayView<const FFrameNumber> Times = KeyedChannel->GetTimes();
+	const int32 KeyCount = Times.Num();
+	const float TicksPerSecond = TickResolution.AsDecimal();
+
+	OutTimestamps.AddUninitialized(KeyCount);
+	OutValues.AddZeroed(KeyCount * 3);
+
+	for (int32 KeyIndex = 0; KeyIndex < KeyCount; ++KeyIndex)
+	{
+		OutTimestamps[KeyIndex] = TickResolution.AsSeconds(FFrameTime(Times[KeyIndex] - StartFrame));
+	}
+
+	for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+	{
+		const FMovieSceneFloatChannel* Channel = Channels[ComponentIndex];
+
+		if (Channel->GetNumKeys() == 0)
+		{
+			for (int32 KeyIndex = 0; KeyIndex < KeyCount; ++KeyIndex)
+			{
+				float Value = 0;
+				Channel->Evaluate(Times[KeyIndex], Value);
+				OutValues[KeyIndex * 3 + 1].Component(ComponentIndex) = Value;
+			}
+
+			continue;
+		}
+
+		const TArrayView<const FMovieSceneFloatValue> Values = Channel->GetValues();
+
+		for (int32 KeyIndex = 0; KeyIndex < KeyCount; ++KeyIndex)
+		{
+			const FMovieSceneFloatValue& Value = Values[KeyIndex];
+			OutValues[KeyIndex * 3 + 1].Component(ComponentIndex) = Value.Value;
+
+			// Tangents of cubic keys are stored per tick, while linear segments have an implicit tangent equal to their slope
+
+			if (KeyIndex > 0)
+			{
+				const FMovieSceneFloatValue& PrevValue = Values[KeyIndex - 1];
+				const float InTangent = PrevValue.InterpMode == RCIM_Linear
+					? (Value.Value - PrevValue.Value) / (OutTimestamps[KeyIndex] - OutTimestamps[KeyIndex - 1])
+					: Value.Tangent.ArriveTangent * TicksPerSecond;
+				OutValues[KeyIndex * 3 + 0].Component(ComponentIndex) = InTangent;
+			}
+
+			if (KeyIndex < KeyCount - 1)
+			{
+				const FMovieSceneFloatValue& NextValue = Values[KeyIndex + 1];
+				const float OutTangent = Value.InterpMode == RCIM_Linear
+					? (NextValue.Value - Value.Value) / (OutTimestamps[KeyIndex + 1] - OutTimestamps[KeyIndex])
+					: Value.Tangent.LeaveTangent * TicksPerSecond;
+				OutValues[KeyIndex * 3 + 2].Component(ComponentIndex) = OutTangent;
+			}
+		}
+	}
+
+	return true;
+}
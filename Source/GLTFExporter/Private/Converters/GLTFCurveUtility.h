@@ -2,9 +2,18 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
+#include "Misc/FrameRate.h"
+
 class UCurveLinearColor;
+struct FMovieSceneFloatChannel;
 
 struct FGLTFCurveUtility
 {
 	static bool HasAnyAdjustment(const UCurveLinearColor& ColorCurve, float Tolerance = KINDA_SMALL_NUMBER);
+
+	// Reads the keys of three channels (i.e. X, Y, and Z) as a cubic spline in glTF layout, i.e. an in-tangent, value, and out-tangent (in units per second)
+	// for each key, with timestamps relative to the start frame. Fails if the channels don't share key times, have keys outside the given frame range, or use
+	// key types (constant or weighted) or extrapolation that a cubic spline can't reproduce exactly.
+	static bool GetCubicSplineKeys(TArrayView<FMovieSceneFloatChannel*> Channels, FFrameNumber StartFrame, FFrameNumber EndFrame, FFrameRate TickResolution, TArray<float>& OutTimestamps, TArray<FVector>& OutValues);
 };
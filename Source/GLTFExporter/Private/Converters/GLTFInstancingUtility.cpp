@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFInstancingUtility.h"
+#include "Converters/GLTFConverterUtility.h"
+#include "Converters/GLTFActorUtility.h"
+#include "Builders/GLTFConvertBuilder.h"
+#include "Engine/StaticMeshActor.h"
+
+void FGLTFInstancingUtility::GetInstanceTransforms(const UInstancedStaticMeshComponent* InstancedMeshComponent, TArray<FTransform>& OutTransforms)
+{
+	const int32 InstanceCount = InstancedMeshComponent->GetInstanceCount();
+	OutTransforms.Reserve(OutTransforms.Num() + InstanceCount);
+
+	for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+	{
+		FTransform Transform;
+		if (InstancedMeshComponent->GetInstanceTransform(InstanceIndex, Transform, false))
+		{
+			OutTransforms.Add(Transform);
+		}
+	}
+}
+
+bool FGLTFInstancingUtility::IsInstanceableActor(const AActor* Actor, bool bSelectedOnly, bool bExportHiddenInGame)
+{
+	const AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(Actor);
+	if (StaticMeshActor == nullptr || (bSelectedOnly && !Actor->IsSelected()) || !FGLTFActorUtility::IsRootActor(Actor, bSelectedOnly))
+	{
+		return false;
+	}
+
+	// Only static actors without attachments can be merged, since nothing else may move or reference the individual instances
+	const UStaticMeshComponent* StaticMeshComponent = StaticMeshActor->GetStaticMeshComponent();
+	if (StaticMeshComponent == nullptr || StaticMeshComponent->Mobility != EComponentMobility::Static || StaticMeshComponent->GetNumChildrenComponents() > 0)
+	{
+		return false;
+	}
+
+	if (StaticMeshComponent->bHiddenInGame && !bExportHiddenInGame)
+	{
+		return false;
+	}
+
+	return StaticMeshComponent->GetStaticMesh() != nullptr;
+}
+
+void FGLTFInstancingUtility::SetNodeInstances(FGLTFConvertBuilder& Builder, FGLTFJsonNodeIndex NodeIndex, const TArray<FTransform>& Transforms)
+{
+	const int32 InstanceCount = Transforms.Num();
+	if (InstanceCount == 0)
+	{
+		return;
+	}
+
+	TArray<FGLTFVector3> Translations;
+	TArray<FGLTFQuaternion> Rotations;
+	TArray<FGLTFVector3> Scales;
+
+	Translations.AddUninitialized(InstanceCount);
+	Rotations.AddUninitialized(InstanceCount);
+	Scales.AddUninitialized(InstanceCount);
+
+	for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+	{
+		const FTransform& Transform = Transforms[InstanceIndex];
+		Translations[InstanceIndex] = FGLTFConverterUtility::ConvertPosition(Transform.GetTranslation(), Builder.ExportOptions->ExportUniformScale);
+		Rotations[InstanceIndex] = FGLTFConverterUtility::ConvertRotation(Transform.GetRotation());
+		Scales[InstanceIndex] = FGLTFConverterUtility::ConvertScale(Transform.GetScale3D());
+	}
+
+	FGLTFJsonAccessor JsonAccessor;
+	JsonAccessor.ComponentType = EGLTFJsonComponentType::F32;
+	JsonAccessor.Count = InstanceCount;
+
+	FGLTFJsonNode& Node = Builder.GetNode(NodeIndex);
+
+	JsonAccessor.BufferView = Builder.AddBufferView(Translations);
+	JsonAccessor.Type = EGLTFJsonAccessorType::Vec3;
+	Node.InstanceTranslations = Builder.AddAccessor(JsonAccessor);
+
+	JsonAccessor.BufferView = Builder.AddBufferView(Rotations);
+	JsonAccessor.Type = EGLTFJsonAccessorType::Vec4;
+	Node.InstanceRotations = Builder.AddAccessor(JsonAccessor);
+
+	JsonAccessor.BufferView = Builder.AddBufferView(Scales);
+	JsonAccessor.Type = EGLTFJsonAccessorType::Vec3;
+	Node.InstanceScales = Builder.AddAccessor(JsonAccessor);
+}
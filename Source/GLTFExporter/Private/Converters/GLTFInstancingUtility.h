@@ -0,0 +1,17 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Json/GLTFJsonIndex.h"
+#include "Engine.h"
+
+class FGLTFConvertBuilder;
+
+struct FGLTFInstancingUtility
+{
+	static void GetInstanceTransforms(const UInstancedStaticMeshComponent* InstancedMeshComponent, TArray<FTransform>& OutTransforms);
+
+	static bool IsInstanceableActor(const AActor* Actor, bool bSelectedOnly, bool bExportHiddenInGame);
+
+	static void SetNodeInstances(FGLTFConvertBuilder& Builder, FGLTFJsonNodeIndex NodeIndex, const TArray<FTransform>& Transforms);
+};
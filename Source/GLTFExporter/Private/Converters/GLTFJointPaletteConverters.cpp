@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFJointPaletteConverters.h"
+#include "Converters/GLTFSkinWeightVertexBufferHack.h"
+#include "Builders/GLTFConvertBuilder.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/MultiSizeIndexContainer.h"
+
+namespace
+{
+	void AddPalette(FGLTFJointPalettes& JointPalettes, TBitArray<>& PaletteBones)
+	{
+		FGLTFSkinJoints& Palette = JointPalettes.Palettes.AddDefaulted_GetRef();
+		Palette.JointIndices.Init(INDEX_NONE, PaletteBones.Num());
+
+		for (TConstSetBitIterator<> It(PaletteBones); It; ++It)
+		{
+			Palette.JointIndices[It.GetIndex()] = Palette.Bones.Add(It.GetIndex());
+		}
+
+		PaletteBones.Init(false, PaletteBones.Num());
+	}
+}
+
+const FGLTFJointPalettes* FGLTFJointPalettesConverter::Convert(const USkeletalMesh* SkeletalMesh, int32 LODIndex)
+{
+	FGLTFJointPalettes* JointPalettes = Outputs.Add_GetRef(MakeUnique<FGLTFJointPalettes>()).Get();
+
+	const FSkeletalMeshLODRenderData& MeshLOD = SkeletalMesh->GetResourceForRendering()->LODRenderData[LODIndex];
+	const FSkinWeightVertexBuffer* VertexBuffer = MeshLOD.GetSkinWeightVertexBuffer();
+	if (VertexBuffer == nullptr || VertexBuffer->GetNumVertices() == 0)
+	{
+		return JointPalettes;
+	}
+
+	// TODO: remove hack
+	const FGLTFSkinWeightVertexBufferHack SkinWeightBuffer(VertexBuffer);
+	const FRawStaticIndexBuffer16or32Interface* IndexBuffer = MeshLOD.MultiSizeIndexContainer.GetIndexBuffer();
+	const int32 MaxJointCount = Builder.ExportOptions->MaximumJointsPerPrimitive;
+
+	TArray<uint32> BoneIndices;
+	TArray<uint8> BoneWeights;
+	BoneIndices.AddUninitialized(VertexBuffer->GetMaxBoneInfluences());
+	BoneWeights.AddUninitialized(VertexBuffer->GetMaxBoneInfluences());
+
+	TBitArray<> PaletteBones(false, SkeletalMesh->RefSkeleton.GetNum());
+	TArray<int32> TriangleBones;
+	int32 PaletteBoneCount = 0;
+	bool bExceedsLimit = false;
+
+	// Triangles are assigned greedily in index buffer order, which tends to keep neighbouring triangles (sharing most of their bones) together
+	for (const FSkelMeshRenderSection& MeshSection : MeshLOD.RenderSections)
+	{
+		const uint32 IndexEnd = MeshSection.BaseIndex + MeshSection.NumTriangles * 3;
+
+		for (uint32 IndexOffset = MeshSection.BaseIndex; IndexOffset < IndexEnd; IndexOffset += 3)
+		{
+			TriangleBones.Reset();
+
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 InfluenceCount = SkinWeightBuffer.GetBoneInfluences(IndexBuffer->Get(IndexOffset + Corner), BoneIndices.GetData(), BoneWeights.GetData());
+
+				for (uint32 InfluenceIndex = 0; InfluenceIndex < InfluenceCount; ++InfluenceIndex)
+				{
+					if (BoneWeights[InfluenceIndex] != 0)
+					{
+						TriangleBones.AddUnique(MeshSection.BoneMap[BoneIndices[InfluenceIndex]]);
+					}
+				}
+			}
+
+			int32 NewBoneCount = 0;
+			for (const int32 BoneIndex : TriangleBones)
+			{
+				NewBoneCount += PaletteBones[BoneIndex] ? 0 : 1;
+			}
+
+			if (PaletteBoneCount + NewBoneCount > MaxJointCount && PaletteBoneCount > 0)
+			{
+				AddPalette(*JointPalettes, PaletteBones);
+				PaletteBoneCount = 0;
+				NewBoneCount = TriangleBones.Num();
+			}
+
+			bExceedsLimit |= NewBoneCount > MaxJointCount;
+
+			for (const int32 BoneIndex : TriangleBones)
+			{
+				PaletteBones[BoneIndex] = true;
+			}
+
+			PaletteBoneCount += NewBoneCount;
+		}
+	}
+
+	if (PaletteBoneCount > 0)
+	{
+		AddPalette(*JointPalettes, PaletteBones);
+	}
+
+	if (bExceedsLimit)
+	{
+		Builder.AddWarningMessage(FString::Printf(
+			TEXT("Some triangles in skeletal mesh %s (LOD %d) are skinned by more than %d joints, which exceeds the joint limit of their primitives"),
+			*SkeletalMesh->GetName(),
+			LODIndex,
+			MaxJointCount));
+	}
+
+	return JointPalettes;
+}
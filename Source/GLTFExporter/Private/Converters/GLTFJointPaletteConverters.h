@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Converters/GLTFConverter.h"
+#include "Converters/GLTFBuilderContext.h"
+#include "Converters/GLTFSkinConverters.h"
+#include "Engine.h"
+
+struct FGLTFJointPalettes
+{
+	// Bones skinning each split of a mesh LOD, at most the joint limit (of the export options) per palette unless a single triangle needs more.
+	// Each triangle belongs to the first palette that contains all of its bones.
+	TArray<FGLTFSkinJoints> Palettes;
+};
+
+class FGLTFJointPalettesConverter final : public FGLTFBuilderContext, public TGLTFConverter<const FGLTFJointPalettes*, const USkeletalMesh*, int32>
+{
+	using FGLTFBuilderContext::FGLTFBuilderContext;
+
+	TArray<TUniquePtr<FGLTFJointPalettes>> Outputs;
+
+	virtual const FGLTFJointPalettes* Convert(const USkeletalMesh* SkeletalMesh, int32 LODIndex) override;
+};
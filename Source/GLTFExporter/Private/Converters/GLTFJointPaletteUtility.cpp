@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFJointPaletteUtility.h"
+#include "Converters/GLTFJointPaletteConverters.h"
+#include "Converters/GLTFSkinWeightConverters.h"
+#include "Converters/GLTFMeshSection.h"
+#include "Builders/GLTFConvertBuilder.h"
+
+namespace
+{
+	void GetTriangleBones(const FGLTFMeshSection& MeshSection, const FGLTFSkinWeights& SkinWeights, uint32 Index, TArray<int32>& OutBones)
+	{
+		const uint32 InfluenceCount = SkinWeights.InfluenceCount;
+		OutBones.Reset();
+
+		for (uint32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 Offset = MeshSection.IndexBuffer[Index + Corner] * InfluenceCount;
+
+			for (uint32 InfluenceIndex = 0; InfluenceIndex < InfluenceCount; ++InfluenceIndex)
+			{
+				if (SkinWeights.Weights[Offset + InfluenceIndex] != 0)
+				{
+					OutBones.AddUnique(SkinWeights.Joints[Offset + InfluenceIndex]);
+				}
+			}
+		}
+	}
+}
+
+bool FGLTFJointPaletteUtility::CanSplitMesh(const FGLTFConvertBuilder& Builder, const USkeletalMeshComponent* SkeletalMeshComponent)
+{
+	if (!Builder.ExportOptions->bExportVertexSkinWeights || Builder.ExportOptions->MaximumJointsPerPrimitive <= 0)
+	{
+		return false;
+	}
+
+	// Palettes are built from the triangles and skin weights of the source LOD, so they don't cover the bones of triangles created by simplification
+	if (Builder.ExportOptions->MeshSimplificationRatio < 1 || Builder.ExportOptions->MaximumMeshTriangleCount > 0 || Builder.ExportOptions->SceneTriangleBudget > 0)
+	{
+		return false;
+	}
+
+	// Nor the bones of skin weights overridden by the component
+	if (SkeletalMeshComponent != nullptr)
+	{
+		for (const FSkelMeshComponentLODInfo& LODInfo : SkeletalMeshComponent->LODInfo)
+		{
+			if (LODInfo.OverrideSkinWeights != nullptr)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int32 FGLTFJointPaletteUtility::FindPalette(const FGLTFJointPalettes& JointPalettes, const TArray<int32>& Bones)
+{
+	for (int32 PaletteIndex = 0; PaletteIndex < JointPalettes.Palettes.Num(); ++PaletteIndex)
+	{
+		const TArray<int32>& JointIndices = JointPalettes.Palettes[PaletteIndex].JointIndices;
+
+		bool bContainsAllBones = true;
+		for (const int32 BoneIndex : Bones)
+		{
+			if (!JointIndices.IsValidIndex(BoneIndex) || JointIndices[BoneIndex] == INDEX_NONE)
+			{
+				bContainsAllBones = false;
+				break;
+			}
+		}
+
+		if (bContainsAllBones)
+		{
+			return PaletteIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void FGLTFJointPaletteUtility::FilterSection(FGLTFMeshSection& MeshSection, const FGLTFSkinWeights& SkinWeights, const FGLTFJointPalettes& JointPalettes, int32 PaletteIndex)
+{
+	const int32 SectionCount = MeshSection.SectionIndexOffsets.Num();
+	const uint32 IndexCount = MeshSection.IndexBuffer.Num();
+
+	TArray<TArray<uint32>> SectionIndexBuffers;
+	SectionIndexBuffers.SetNum(SectionCount);
+
+	TArray<int32> TriangleBones;
+
+	for (int32 SectionPosition = 0; SectionPosition < SectionCount; ++SectionPosition)
+	{
+		const uint32 IndexOffset = MeshSection.SectionIndexOffsets[SectionPosition];
+		const uint32 IndexEnd = SectionPosition + 1 < SectionCount ? MeshSection.SectionIndexOffsets[SectionPosition + 1] : IndexCount;
+
+		for (uint32 Index = IndexOffset; Index < IndexEnd; Index += 3)
+		{
+			GetTriangleBones(MeshSection, SkinWeights, Index, TriangleBones);
+
+			if (FindPalette(JointPalettes, TriangleBones) == PaletteIndex)
+			{
+				SectionIndexBuffers[SectionPosition].Append(MeshSection.IndexBuffer.GetData() + Index, 3);
+			}
+		}
+	}
+
+	MeshSection.SetSectionIndexBuffers(SectionIndexBuffers);
+}
+
+uint32 FGLTFJointPaletteUtility::CountUncoveredTriangles(const FGLTFMeshSection& MeshSection, const FGLTFSkinWeights& SkinWeights, const FGLTFJointPalettes& JointPalettes)
+{
+	const uint32 IndexCount = MeshSection.IndexBuffer.Num();
+	uint32 UncoveredCount = 0;
+
+	TArray<int32> TriangleBones;
+
+	for (uint32 Index = 0; Index + 2 < IndexCount; Index += 3)
+	{
+		GetTriangleBones(MeshSection, SkinWeights, Index, TriangleBones);
+		UncoveredCount += FindPalette(JointPalettes, TriangleBones) == INDEX_NONE ? 1 : 0;
+	}
+
+	return UncoveredCount;
+}
+
+void FGLTFJointPaletteUtility::AddPaletteNodes(FGLTFConvertBuilder& Builder, FGLTFJsonNodeIndex MeshNodeIndex, const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex, TArray<FGLTFJsonNodeIndex>& OutMeshNodeIndices, TArray<const FGLTFSkinJoints*>& OutJointPalettes)
+{
+	const FGLTFJointPalettes* JointPalettes = Builder.GetOrAddJointPalettes(SkeletalMesh, LODIndex);
+	const int32 PaletteCount = JointPalettes != nullptr ? JointPalettes->Palettes.Num() : 0;
+
+	OutMeshNodeIndices.Add(MeshNodeIndex);
+
+	if (PaletteCount <= 1)
+	{
+		OutJointPalettes.Add(nullptr);
+		return;
+	}
+
+	OutJointPalettes.Add(&JointPalettes->Palettes[0]);
+
+	// The transform of a skinned mesh node is ignored (in favor of its joints), so each split can simply be a child of the mesh node
+	FGLTFJsonNode PaletteNode;
+	PaletteNode.Name = Builder.GetNode(MeshNodeIndex).Name;
+
+	for (int32 PaletteIndex = 1; PaletteIndex < PaletteCount; ++PaletteIndex)
+	{
+		const FGLTFJsonMeshIndex MeshIndex = SkeletalMeshComponent != nullptr
+			? Builder.GetOrAddMesh(SkeletalMeshComponent, {}, LODIndex, PaletteIndex)
+			: Builder.GetOrAddMesh(SkeletalMesh, {}, LODIndex, PaletteIndex);
+
+		const FGLTFJsonNodeIndex PaletteNodeIndex = Builder.AddChildNode(MeshNodeIndex, PaletteNode);
+		OutMeshNodeIndices.Add(Builder.SetNodeMesh(PaletteNodeIndex, MeshIndex));
+		OutJointPalettes.Add(&JointPalettes->Palettes[PaletteIndex]);
+	}
+}
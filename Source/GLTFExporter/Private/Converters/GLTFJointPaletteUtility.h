@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Json/GLTFJsonIndex.h"
+#include "Engine.h"
+
+class FGLTFConvertBuilder;
+struct FGLTFMeshSection;
+struct FGLTFSkinWeights;
+struct FGLTFSkinJoints;
+struct FGLTFJointPalettes;
+
+struct FGLTFJointPaletteUtility
+{
+	// Returns true if meshes of the skeletal mesh (component) may be split by joint palettes, i.e. when the exported triangles and skin weights are those the palettes are built from
+	static bool CanSplitMesh(const FGLTFConvertBuilder& Builder, const USkeletalMeshComponent* SkeletalMeshComponent);
+
+	// Returns the first palette that contains all the given bones, or INDEX_NONE if none does
+	static int32 FindPalette(const FGLTFJointPalettes& JointPalettes, const TArray<int32>& Bones);
+
+	// Removes all triangles of the mesh section (and their unreferenced vertices) that don't belong to the given palette.
+	// Triangles that no palette fully contains are removed from every palette, rather than binding some of their influences to the wrong joints.
+	static void FilterSection(FGLTFMeshSection& MeshSection, const FGLTFSkinWeights& SkinWeights, const FGLTFJointPalettes& JointPalettes, int32 PaletteIndex);
+
+	// Returns the number of triangles of the mesh section that no palette fully contains
+	static uint32 CountUncoveredTriangles(const FGLTFMeshSection& MeshSection, const FGLTFSkinWeights& SkinWeights, const FGLTFJointPalettes& JointPalettes);
+
+	// Adds a child node (with a separate mesh) for every joint palette of the skeletal mesh but the first, which is used by the mesh node itself.
+	// Outputs every mesh node (starting with the given one) together with its joint palette, or nullptr if the mesh isn't split.
+	static void AddPaletteNodes(FGLTFConvertBuilder& Builder, FGLTFJsonNodeIndex MeshNodeIndex, const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex, TArray<FGLTFJsonNodeIndex>& OutMeshNodeIndices, TArray<const FGLTFSkinJoints*>& OutJointPalettes);
+};
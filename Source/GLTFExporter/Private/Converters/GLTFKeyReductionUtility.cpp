@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFKeyReductionUtility.h"
+#include "Algo/AllOf.h"
+
+namespace
+{
+	FVector ToEngine(const FGLTFVector3& Value)
+	{
+		return { Value.X, Value.Y, Value.Z };
+	}
+
+	FQuat ToEngine(const FGLTFQuaternion& Value)
+	{
+		return { Value.X, Value.Y, Value.Z, Value.W };
+	}
+
+	float GetError(const FVector& A, const FVector& B)
+	{
+		return FVector::Dist(A, B);
+	}
+
+	float GetError(const FQuat& A, const FQuat& B)
+	{
+		return A.AngularDistance(B);
+	}
+
+	FVector Interpolate(const FVector& A, const FVector& B, float Alpha)
+	{
+		return FMath::Lerp(A, B, Alpha);
+	}
+
+	FQuat Interpolate(const FQuat& A, const FQuat& B, float Alpha)
+	{
+		// Matches the spherical linear interpolation used for rotations in glTF
+		return FQuat::Slerp(A, B, Alpha);
+	}
+
+	template <typename ValueType>
+	bool CanInterpolate(const TArray<float>& Timestamps, const TArray<ValueType>& Values, int32 StartKey, int32 EndKey, float Tolerance)
+	{
+		const float Duration = Timestamps[EndKey] - Timestamps[StartKey];
+
+		for (int32 Key = StartKey + 1; Key < EndKey; ++Key)
+		{
+			const float Alpha = Duration > 0 ? (Timestamps[Key] - Timestamps[StartKey]) / Duration : 0;
+			if (GetError(Interpolate(Values[StartKey], Values[EndKey], Alpha), Values[Key]) > Tolerance)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename GLTFValueType>
+	TArray<int32> GetReducedKeys(const TArray<float>& Timestamps, const TArray<GLTFValueType>& GLTFValues, EGLTFJsonInterpolation Interpolation, float Tolerance)
+	{
+		typedef decltype(ToEngine(GLTFValues[0])) ValueType;
+
+		const int32 KeyCount = GLTFValues.Num();
+		TArray<int32> Keys;
+
+		if (KeyCount == 0)
+		{
+			return Keys;
+		}
+
+		TArray<ValueType> Values;
+		Values.Reserve(KeyCount);
+
+		for (const GLTFValueType& GLTFValue : GLTFValues)
+		{
+			Values.Add(ToEngine(GLTFValue));
+		}
+
+		Keys.Add(0);
+
+		const bool bIsConstant = Algo::AllOf(Values, [&Values, Tolerance](const ValueType& Value) { return GetError(Value, Values[0]) <= Tolerance; });
+		if (bIsConstant)
+		{
+			return Keys;
+		}
+
+		if (Interpolation == EGLTFJsonInterpolation::Step)
+		{
+			// When stepping, a key is only needed if it changes the value held since the previous key
+			for (int32 Key = 1; Key < KeyCount; ++Key)
+			{
+				if (GetError(Values[Key], Values[Keys.Last()]) > Tolerance)
+				{
+					Keys.Add(Key);
+				}
+			}
+
+			return Keys;
+		}
+
+		// Each segment is extended greedily for as long as interpolating between its end keys reproduces all the keys in between
+		int32 StartKey = 0;
+		while (StartKey < KeyCount - 1)
+		{
+			int32 EndKey = StartKey + 1;
+			while (EndKey + 1 < KeyCount && CanInterpolate(Timestamps, Values, StartKey, EndKey + 1, Tolerance))
+			{
+				++EndKey;
+			}
+
+			Keys.Add(EndKey);
+			StartKey = EndKey;
+		}
+
+		return Keys;
+	}
+}
+
+TArray<int32> FGLTFKeyReductionUtility::ReduceKeys(const TArray<float>& Timestamps, const TArray<FGLTFVector3>& Values, EGLTFJsonInterpolation Interpolation, float Tolerance)
+{
+	return GetReducedKeys(Timestamps, Values, Interpolation, Tolerance);
+}
+
+TArray<int32> FGLTFKeyReductionUtility::ReduceKeys(const TArray<float>& Timestamps, const TArray<FGLTFQuaternion>& Values, EGLTFJsonInterpolation Interpolation, float Tolerance)
+{
+	return GetReducedKeys(Timestamps, Values, Interpolation, Tolerance);
+}
+
+bool FGLTFKeyReductionUtility::IsNearlyEqual(const FGLTFVector3& A, const FGLTFVector3& B, float Tolerance)
+{
+	return GetError(ToEngine(A), ToEngine(B)) <= Tolerance;
+}
+
+bool FGLTFKeyReductionUtility::IsNearlyEqual(const FGLTFQuaternion& A, const FGLTFQuaternion& B, float Tolerance)
+{
+	return GetError(ToEngine(A), ToEngine(B)) <= Tolerance;
+}
@@ -0,0 +1,20 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Json/GLTFJsonEnums.h"
+#include "Core/GLTFVector.h"
+#include "Core/GLTFQuaternion.h"
+#include "CoreMinimal.h"
+
+struct FGLTFKeyReductionUtility
+{
+	// Returns the indices of the keys needed to reproduce every key within the given tolerance when interpolating between them.
+	// Tolerance is a distance for vectors (i.e. translations and scales) and an angle in radians for rotations.
+	// Tracks that are constant within the tolerance are reduced to their first key only.
+	static TArray<int32> ReduceKeys(const TArray<float>& Timestamps, const TArray<FGLTFVector3>& Values, EGLTFJsonInterpolation Interpolation, float Tolerance);
+	static TArray<int32> ReduceKeys(const TArray<float>& Timestamps, const TArray<FGLTFQuaternion>& Values, EGLTFJsonInterpolation Interpolation, float Tolerance);
+
+	static bool IsNearlyEqual(const FGLTFVector3& A, const FGLTFVector3& B, float Tolerance);
+	static bool IsNearlyEqual(const FGLTFQuaternion& A, const FGLTFQuaternion& B, float Tolerance);
+};
@@ -5,7 +5,25 @@
 #include "Builders/GLTFContainerBuilder.h"
 #include "Engine/MapBuildDataRegistry.h"
 
-FGLTFJsonLightMapIndex FGLTFLightMapConverter::Convert(const UStaticMeshComponent* StaticMeshComponent)
+void FGLTFLightMapConverter::Sanitize(const UStaticMeshComponent*& StaticMeshComponent, int32& LODIndex)
+{
+	const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+	if (StaticMesh == nullptr)
+	{
+		return;
+	}
+
+	if (LODIndex < 0)
+	{
+		LODIndex = FGLTFMeshUtility::GetLOD(StaticMesh, StaticMeshComponent, Builder.ExportOptions->DefaultLevelOfDetail);
+	}
+	else
+	{
+		LODIndex = FMath::Min(LODIndex, FGLTFMeshUtility::GetMaximumLOD(StaticMesh));
+	}
+}
+
+FGLTFJsonLightMapIndex FGLTFLightMapConverter::Convert(const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex)
 {
 	const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
 
@@ -14,7 +32,6 @@ FGLTFJsonLightMapIndex FGLTFLightMapConverter::Convert(const UStaticMeshComponen
 		return FGLTFJsonLightMapIndex(INDEX_NONE);
 	}
 
-	const int32 LODIndex = FGLTFMeshUtility::GetLOD(StaticMesh, StaticMeshComponent, Builder.ExportOptions->DefaultLevelOfDetail);
 	const FStaticMeshLODResources& LODResources = StaticMesh->GetLODForExport(LODIndex);
 
 	const int32 CoordinateIndex = StaticMesh->LightMapCoordinateIndex;
@@ -23,13 +40,13 @@ FGLTFJsonLightMapIndex FGLTFLightMapConverter::Convert(const UStaticMeshComponen
 		return FGLTFJsonLightMapIndex(INDEX_NONE);
 	}
 
-	const int32 LightMapLODIndex = 0;
-	if (!StaticMeshComponent->LODData.IsValidIndex(LightMapLODIndex))
+	// NOTE: each level of detail has its own lightmap, since the lightmap coordinates differ between levels
+	if (!StaticMeshComponent->LODData.IsValidIndex(LODIndex))
 	{
 		return FGLTFJsonLightMapIndex(INDEX_NONE);
 	}
 
-	const FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[LightMapLODIndex];
+	const FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[LODIndex];
 	const FMeshMapBuildData* MeshMapBuildData = StaticMeshComponent->GetMeshMapBuildData(ComponentLODInfo);
 
 	if (MeshMapBuildData == nullptr || MeshMapBuildData->LightMap == nullptr)
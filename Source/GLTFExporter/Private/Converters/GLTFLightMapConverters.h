@@ -7,9 +7,11 @@
 #include "Converters/GLTFBuilderContext.h"
 #include "Engine.h"
 
-class FGLTFLightMapConverter final : public FGLTFBuilderContext, public TGLTFConverter<FGLTFJsonLightMapIndex, const UStaticMeshComponent*>
+class FGLTFLightMapConverter final : public FGLTFBuilderContext, public TGLTFConverter<FGLTFJsonLightMapIndex, const UStaticMeshComponent*, int32>
 {
 	using FGLTFBuilderContext::FGLTFBuilderContext;
 
-	virtual FGLTFJsonLightMapIndex Convert(const UStaticMeshComponent* StaticMeshComponent) override;
+	virtual void Sanitize(const UStaticMeshComponent*& StaticMeshComponent, int32& LODIndex) override;
+
+	virtual FGLTFJsonLightMapIndex Convert(const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex) override;
 };
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFMaterialBakeQueue.h"
+#include "Converters/GLTFMaterialUtility.h"
+#include "Tasks/GLTFMaterialTasks.h"
+
+namespace
+{
+	// Keeps a batch at about 256 MB (4 bytes per pixel, held until each of its tasks completes), i.e. sixteen 2048x2048 properties
+	const int64 MaxPixelsPerBakeBatch = 4 * 4096 * 4096;
+}
+
+void FGLTFMaterialBakeQueue::AddTask(FGLTFMaterialTask* Task)
+{
+	PendingTasks.Add(Task);
+}
+
+void FGLTFMaterialBakeQueue::RemoveTask(FGLTFMaterialTask* Task)
+{
+	PendingTasks.Remove(Task);
+}
+
+void FGLTFMaterialBakeQueue::BakeTask(FGLTFMaterialTask* Task)
+{
+	const int32 TaskIndex = PendingTasks.Find(Task);
+	if (TaskIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TArray<FGLTFPropertyBake*> BatchBakes;
+	int64 BatchPixelCount = 0;
+
+	int32 PendingIndex = TaskIndex;
+	for (; PendingIndex < PendingTasks.Num(); ++PendingIndex)
+	{
+		TArray<FGLTFPropertyBake*> TaskBakes;
+		PendingTasks[PendingIndex]->GetPendingPropertyBakes(TaskBakes);
+
+		int64 TaskPixelCount = 0;
+		for (const FGLTFPropertyBake* PropertyBake : TaskBakes)
+		{
+			TaskPixelCount += static_cast<int64>(PropertyBake->Input.Size.X) * PropertyBake->Input.Size.Y;
+		}
+
+		if (PendingIndex > TaskIndex && BatchPixelCount + TaskPixelCount > MaxPixelsPerBakeBatch)
+		{
+			break;
+		}
+
+		BatchBakes.Append(TaskBakes);
+		BatchPixelCount += TaskPixelCount;
+	}
+
+	PendingTasks.RemoveAt(TaskIndex, PendingIndex - TaskIndex);
+
+	if (BatchBakes.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FGLTFPropertyBakeInput> BatchInputs;
+	BatchInputs.Reserve(BatchBakes.Num());
+
+	for (const FGLTFPropertyBake* PropertyBake : BatchBakes)
+	{
+		BatchInputs.Add(PropertyBake->Input);
+	}
+
+	TArray<FGLTFPropertyBakeOutput> BatchOutputs;
+	FGLTFMaterialUtility::BakeMaterialProperties(BatchInputs, BatchOutputs);
+
+	for (int32 Index = 0; Index < BatchBakes.Num(); ++Index)
+	{
+		BatchBakes[Index]->Output.Emplace(MoveTemp(BatchOutputs[Index]));
+	}
+}
@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FGLTFMaterialTask;
+
+// Collects the expected property bakes of all material tasks, so that properties from many materials can be baked in the same call to the material baking module
+class FGLTFMaterialBakeQueue
+{
+public:
+
+	void AddTask(FGLTFMaterialTask* Task);
+
+	void RemoveTask(FGLTFMaterialTask* Task);
+
+	// Bakes the pending properties of the given task together with those of the tasks queued after it (until the batch is full), then sets the output of each.
+	// Does nothing if the task has already been baked as part of an earlier batch.
+	void BakeTask(FGLTFMaterialTask* Task);
+
+private:
+
+	TArray<FGLTFMaterialTask*> PendingTasks;
+};
@@ -47,6 +47,7 @@ FGLTFJsonMaterialIndex FGLTFMaterialConverter::Convert(const UMaterialInterface*
 	}
 
 	const FGLTFJsonMaterialIndex MaterialIndex = Builder.AddMaterial();
-	Builder.SetupTask<FGLTFMaterialTask>(Builder, UVOverlapChecker, Material, MeshData, SectionIndices, MaterialIndex);
+	Builder.SetupTask<FGLTFMaterialTask>(Builder, UVOverlapChecker, BakeQueue, Material, MeshData, SectionIndices, MaterialIndex);
+
 	return MaterialIndex;
 }
@@ -9,6 +9,7 @@
 #include "Converters/GLTFIndexArray.h"
 #include "Converters/GLTFUVOverlapChecker.h"
 #include "Converters/GLTFUVDegenerateChecker.h"
+#include "Converters/GLTFMaterialBakeQueue.h"
 #include "Engine.h"
 
 class FGLTFMaterialConverter final : public FGLTFBuilderContext, public TGLTFConverter<FGLTFJsonMaterialIndex, const UMaterialInterface*, const FGLTFMeshData*, FGLTFIndexArray>
@@ -21,4 +22,7 @@ class FGLTFMaterialConverter final : public FGLTFBuilderContext, public TGLTFCon
 
 	FGLTFUVOverlapChecker UVOverlapChecker;
 	FGLTFUVDegenerateChecker UVDegenerateChecker;
+
+	// NOTE: shared with the tasks, since they are destroyed after the converters
+	TSharedRef<FGLTFMaterialBakeQueue> BakeQueue = MakeShared<FGLTFMaterialBakeQueue>();
 };
@@ -210,69 +210,122 @@ bool FGLTFMaterialUtility::CombineTextures(TArray<FColor>& OutPixels, const TArr
 
 FGLTFPropertyBakeOutput FGLTFMaterialUtility::BakeMaterialProperty(const FIntPoint& OutputSize, const FMaterialPropertyEx& Property, const UMaterialInterface* Material, int32 TexCoord, const FMeshDescription* MeshDescription, const FGLTFIndexArray& MeshSectionIndices, bool bCopyAlphaFromRedChannel)
 {
-	FMeshData MeshSet;
-	MeshSet.TextureCoordinateBox = { { 0.0f, 0.0f }, { 1.0f, 1.0f } };
-	MeshSet.TextureCoordinateIndex = TexCoord;
-	MeshSet.RawMeshDescription = const_cast<FMeshDescription*>(MeshDescription);
-	MeshSet.MaterialIndices = MeshSectionIndices; // NOTE: MaterialIndices is actually section indices
+	const TArray<FGLTFPropertyBakeInput> Inputs = { FGLTFPropertyBakeInput(Property, OutputSize, Material, TexCoord, MeshDescription, MeshSectionIndices, bCopyAlphaFromRedChannel) };
 
-	FMaterialDataEx MatSet;
-	MatSet.Material = const_cast<UMaterialInterface*>(Material);
-	MatSet.PropertySizes.Add(Property, OutputSize);
+	TArray<FGLTFPropertyBakeOutput> Outputs;
+	BakeMaterialProperties(Inputs, Outputs);
+
+	return Outputs[0];
+}
+
+void FGLTFMaterialUtility::BakeMaterialProperties(const TArray<FGLTFPropertyBakeInput>& Inputs, TArray<FGLTFPropertyBakeOutput>& OutOutputs)
+{
+	TArray<FMeshData> MeshSets;
+	TArray<FMaterialDataEx> MatSets;
+	TArray<int32> SetIndices;
+	SetIndices.Reserve(Inputs.Num());
+
+	// NOTE: properties are grouped into one set per material and mesh, unless the same property is requested more than once
+	for (const FGLTFPropertyBakeInput& Input : Inputs)
+	{
+		int32 SetIndex = INDEX_NONE;
+
+		for (int32 Index = 0; Index < MatSets.Num(); ++Index)
+		{
+			const FMeshData& MeshSet = MeshSets[Index];
+			const FMaterialDataEx& MatSet = MatSets[Index];
+
+			if (MatSet.Material == Input.Material &&
+				MeshSet.RawMeshDescription == Input.MeshDescription &&
+				MeshSet.TextureCoordinateIndex == Input.TexCoord &&
+				MeshSet.MaterialIndices == Input.MeshSectionIndices &&
+				!MatSet.PropertySizes.Contains(Input.Property))
+			{
+				SetIndex = Index;
+				break;
+			}
+		}
+
+		if (SetIndex == INDEX_NONE)
+		{
+			SetIndex = MatSets.Num();
+
+			FMeshData& MeshSet = MeshSets.AddDefaulted_GetRef();
+			MeshSet.TextureCoordinateBox = { { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+			MeshSet.TextureCoordinateIndex = Input.TexCoord;
+			MeshSet.RawMeshDescription = const_cast<FMeshDescription*>(Input.MeshDescription);
+			MeshSet.MaterialIndices = Input.MeshSectionIndices; // NOTE: MaterialIndices is actually section indices
+
+			FMaterialDataEx& MatSet = MatSets.AddDefaulted_GetRef();
+			MatSet.Material = const_cast<UMaterialInterface*>(Input.Material);
+		}
+
+		MatSets[SetIndex].PropertySizes.Add(Input.Property, Input.Size);
+		SetIndices.Add(SetIndex);
+	}
 
 	TArray<FMeshData*> MeshSettings;
 	TArray<FMaterialDataEx*> MatSettings;
-	MeshSettings.Add(&MeshSet);
-	MatSettings.Add(&MatSet);
+
+	for (int32 SetIndex = 0; SetIndex < MatSets.Num(); ++SetIndex)
+	{
+		MeshSettings.Add(&MeshSets[SetIndex]);
+		MatSettings.Add(&MatSets[SetIndex]);
+	}
 
 	TArray<FBakeOutputEx> BakeOutputs;
 	IMaterialBakingModule& Module = FModuleManager::Get().LoadModuleChecked<IMaterialBakingModule>("GLTFMaterialBaking");
 
 	Module.BakeMaterials(MatSettings, MeshSettings, BakeOutputs);
 
-	FBakeOutputEx& BakeOutput = BakeOutputs[0];
-
-	TArray<FColor> BakedPixels = MoveTemp(BakeOutput.PropertyData.FindChecked(Property));
-	const FIntPoint BakedSize = BakeOutput.PropertySizes.FindChecked(Property);
-	const float EmissiveScale = BakeOutput.EmissiveScale;
+	OutOutputs.Reserve(OutOutputs.Num() + Inputs.Num());
 
-	if (bCopyAlphaFromRedChannel)
+	for (int32 InputIndex = 0; InputIndex < Inputs.Num(); ++InputIndex)
 	{
-		for (FColor& Pixel: BakedPixels)
+		const FGLTFPropertyBakeInput& Input = Inputs[InputIndex];
+		const FMaterialPropertyEx& Property = Input.Property;
+		FBakeOutputEx& BakeOutput = BakeOutputs[SetIndices[InputIndex]];
+
+		TArray<FColor> BakedPixels = MoveTemp(BakeOutput.PropertyData.FindChecked(Property));
+		const FIntPoint BakedSize = BakeOutput.PropertySizes.FindChecked(Property);
+		const float EmissiveScale = BakeOutput.EmissiveScale;
+
+		if (Input.bCopyAlphaFromRedChannel)
 		{
-			Pixel.A = Pixel.R;
+			for (FColor& Pixel: BakedPixels)
+			{
+				Pixel.A = Pixel.R;
+			}
 		}
-	}
-	else
-	{
-		// NOTE: alpha is 0 by default after baking a property, but we prefer 255 (1.0).
-		// It makes it easier to view the exported textures.
-		for (FColor& Pixel: BakedPixels)
+		else
 		{
-			Pixel.A = 255;
+			// NOTE: alpha is 0 by default after baking a property, but we prefer 255 (1.0).
+			// It makes it easier to view the exported textures.
+			for (FColor& Pixel: BakedPixels)
+			{
+				Pixel.A = 255;
+			}
 		}
-	}
 
-	if (IsNormalMap(Property))
-	{
-		// Convert normalmaps to use +Y (OpenGL / WebGL standard)
-		FGLTFTextureUtility::FlipGreenChannel(BakedPixels);
-	}
+		if (IsNormalMap(Property))
+		{
+			// Convert normalmaps to use +Y (OpenGL / WebGL standard)
+			FGLTFTextureUtility::FlipGreenChannel(BakedPixels);
+		}
 
-	FGLTFPropertyBakeOutput PropertyBakeOutput(Property, PF_B8G8R8A8, BakedPixels, BakedSize, EmissiveScale);
+		FGLTFPropertyBakeOutput& PropertyBakeOutput = OutOutputs.Emplace_GetRef(Property, PF_B8G8R8A8, BakedPixels, BakedSize, EmissiveScale);
 
-	if (BakedPixels.Num() == 1)
-	{
-		const FColor& Pixel = BakedPixels[0];
+		if (BakedPixels.Num() == 1)
+		{
+			const FColor& Pixel = BakedPixels[0];
 
-		PropertyBakeOutput.bIsConstant = true;
+			PropertyBakeOutput.bIsConstant = true;
 
-		// TODO: is the current conversion from sRGB => linear correct?
-		// It seems to give correct results for some properties, but not all.
-		PropertyBakeOutput.ConstantValue = Pixel;
+			// TODO: is the current conversion from sRGB => linear correct?
+			// It seems to give correct results for some properties, but not all.
+			PropertyBakeOutput.ConstantValue = Pixel;
+		}
 	}
-
-	return PropertyBakeOutput;
 }
 
 FGLTFJsonTextureIndex FGLTFMaterialUtility::AddCombinedTexture(FGLTFConvertBuilder& Builder, const TArray<FGLTFTextureCombineSource>& CombineSources, const FIntPoint& TextureSize, bool bIgnoreAlpha, const FString& TextureName, EGLTFJsonTextureFilter MinFilter, EGLTFJsonTextureFilter MagFilter, EGLTFJsonTextureWrap WrapS, EGLTFJsonTextureWrap WrapT)
@@ -3,10 +3,10 @@
 #pragma once
 
 #include "Builders/GLTFContainerBuilder.h"
+#include "MaterialPropertyEx.h"
 #include "Engine/Texture2D.h"
 
 struct FGLTFMaterialAnalysis;
-struct FMaterialPropertyEx;
 
 struct FGLTFTextureCombineSource
 {
@@ -19,13 +19,39 @@ struct FGLTFTextureCombineSource
 	ESimpleElementBlendMode BlendMode;
 };
 
+struct FGLTFPropertyBakeInput
+{
+	FORCEINLINE FGLTFPropertyBakeInput(const FMaterialPropertyEx& Property, const FIntPoint& Size, const UMaterialInterface* Material, int32 TexCoord, const FMeshDescription* MeshDescription, const FGLTFIndexArray& MeshSectionIndices, bool bCopyAlphaFromRedChannel)
+		: Property(Property), Size(Size), Material(Material), TexCoord(TexCoord), MeshDescription(MeshDescription), MeshSectionIndices(MeshSectionIndices), bCopyAlphaFromRedChannel(bCopyAlphaFromRedChannel)
+	{}
+
+	FMaterialPropertyEx Property;
+	FIntPoint Size;
+	const UMaterialInterface* Material;
+	int32 TexCoord;
+	const FMeshDescription* MeshDescription;
+	FGLTFIndexArray MeshSectionIndices;
+	bool bCopyAlphaFromRedChannel;
+
+	bool operator==(const FGLTFPropertyBakeInput& Other) const
+	{
+		return Property == Other.Property &&
+			Size == Other.Size &&
+			Material == Other.Material &&
+			TexCoord == Other.TexCoord &&
+			MeshDescription == Other.MeshDescription &&
+			MeshSectionIndices == Other.MeshSectionIndices &&
+			bCopyAlphaFromRedChannel == Other.bCopyAlphaFromRedChannel;
+	}
+};
+
 struct FGLTFPropertyBakeOutput
 {
 	FORCEINLINE FGLTFPropertyBakeOutput(const FMaterialPropertyEx& Property, EPixelFormat PixelFormat, TArray<FColor>& Pixels, FIntPoint Size, float EmissiveScale)
 		: Property(Property), PixelFormat(PixelFormat), Pixels(Pixels), Size(Size), EmissiveScale(EmissiveScale), bIsConstant(false)
 	{}
 
-	const FMaterialPropertyEx& Property;
+	FMaterialPropertyEx Property;
 	EPixelFormat PixelFormat;
 	TArray<FColor> Pixels;
 	FIntPoint Size;
@@ -35,6 +61,17 @@ struct FGLTFPropertyBakeOutput
 	FLinearColor ConstantValue;
 };
 
+// Pairs a property expected to be baked with its output, which is set once the property has been baked (as part of a batch)
+struct FGLTFPropertyBake
+{
+	FORCEINLINE FGLTFPropertyBake(const FGLTFPropertyBakeInput& Input)
+		: Input(Input)
+	{}
+
+	FGLTFPropertyBakeInput Input;
+	TOptional<FGLTFPropertyBakeOutput> Output;
+};
+
 struct FGLTFMaterialUtility
 {
 	static UMaterialInterface* GetDefault();
@@ -59,6 +96,9 @@ struct FGLTFMaterialUtility
 	static bool CombineTextures(TArray<FColor>& OutPixels, const TArray<FGLTFTextureCombineSource>& Sources, const FIntPoint& OutputSize, EPixelFormat OutputPixelFormat);
 	static FGLTFPropertyBakeOutput BakeMaterialProperty(const FIntPoint& OutputSize, const FMaterialPropertyEx& Property, const UMaterialInterface* Material, int32 TexCoord, const FMeshDescription* MeshDescription = nullptr, const FGLTFIndexArray& MeshSectionIndices = {}, bool bCopyAlphaFromRedChannel = false);
 
+	// Bakes all given properties using as few calls to the material baking module as possible, outputs are returned in the same order as the inputs
+	static void BakeMaterialProperties(const TArray<FGLTFPropertyBakeInput>& Inputs, TArray<FGLTFPropertyBakeOutput>& OutOutputs);
+
 	static FGLTFJsonTextureIndex AddCombinedTexture(FGLTFConvertBuilder& Builder, const TArray<FGLTFTextureCombineSource>& CombineSources, const FIntPoint& TextureSize, bool bIgnoreAlpha, const FString& TextureName, EGLTFJsonTextureFilter MinFilter, EGLTFJsonTextureFilter MagFilter, EGLTFJsonTextureWrap WrapS, EGLTFJsonTextureWrap WrapT);
 	static FGLTFJsonTextureIndex AddTexture(FGLTFConvertBuilder& Builder, const TArray<FColor>& Pixels, const FIntPoint& TextureSize, bool bIgnoreAlpha, bool bIsNormalMap, const FString& TextureName, EGLTFJsonTextureFilter MinFilter, EGLTFJsonTextureFilter MagFilter, EGLTFJsonTextureWrap WrapS, EGLTFJsonTextureWrap WrapT);
 
@@ -5,8 +5,16 @@
 #include "Converters/GLTFMaterialUtility.h"
 #include "Builders/GLTFConvertBuilder.h"
 #include "Tasks/GLTFMeshTasks.h"
+#include "Rendering/SkeletalMeshRenderData.h"
 
-void FGLTFStaticMeshConverter::Sanitize(const UStaticMesh*& StaticMesh, const UStaticMeshComponent*& StaticMeshComponent, FGLTFMaterialArray& Materials, int32& LODIndex)
+void FGLTFStaticMeshConverter::ReleaseMeshSections()
+{
+	MeshSectionConverter.ReleaseOutputs();
+	SharedMeshSectionConverter.ReleaseOutputs();
+	SimplifiedMeshSectionConverter.ReleaseOutputs();
+}
+
+void FGLTFStaticMeshConverter::Sanitize(const UStaticMesh*& StaticMesh, const UStaticMeshComponent*& StaticMeshComponent, FGLTFMaterialArray& Materials, int32& LODIndex, bool& bQuantizePositions)
 {
 	if (StaticMeshComponent != nullptr)
 	{
@@ -36,16 +44,48 @@ void FGLTFStaticMeshConverter::Sanitize(const UStaticMesh*& StaticMesh, const US
 			StaticMeshComponent = nullptr;
 		}
 	}
+
+	if (!Builder.ExportOptions->bUseMeshQuantization || Builder.ExportOptions->PositionQuantizationTolerance <= 0)
+	{
+		bQuantizePositions = false;
+	}
 }
 
-FGLTFJsonMeshIndex FGLTFStaticMeshConverter::Convert(const UStaticMesh* StaticMesh,  const UStaticMeshComponent* StaticMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex)
+FGLTFJsonMeshIndex FGLTFStaticMeshConverter::Convert(const UStaticMesh* StaticMesh,  const UStaticMeshComponent* StaticMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex, bool bQuantizePositions)
 {
 	const FGLTFJsonMeshIndex MeshIndex = Builder.AddMesh();
-	Builder.SetupTask<FGLTFStaticMeshTask>(Builder, MeshSectionConverter, StaticMesh, StaticMeshComponent, Materials, LODIndex, MeshIndex);
+
+	const FStaticMeshLODResources& MeshLOD = StaticMesh->GetLODForExport(LODIndex);
+
+	if (bQuantizePositions)
+	{
+		// The dequantization transform must be known up front, since it's applied by the nodes that instance this mesh
+		const FGLTFPositionQuantization Quantization = Builder.GetOrAddPositionQuantization(&MeshLOD.VertexBuffers.PositionVertexBuffer);
+
+		if (Quantization.bIsValid)
+		{
+			FGLTFJsonMesh& JsonMesh = Builder.GetMesh(MeshIndex);
+			JsonMesh.bQuantizedPositions = true;
+			JsonMesh.DequantizationTranslation = Quantization.Translation;
+			JsonMesh.DequantizationScale = Quantization.Scale;
+		}
+	}
+
+	Builder.MeshSimplificationBudget.AddMesh(MeshIndex, MeshLOD.GetNumTriangles(), StaticMesh->GetBounds().SphereRadius);
+
+	Builder.SetupTask<FGLTFStaticMeshTask>(Builder, MeshSectionConverter, SharedMeshSectionConverter, SimplifiedMeshSectionConverter, StaticMesh, StaticMeshComponent, Materials, LODIndex, MeshIndex);
 	return MeshIndex;
 }
 
-void FGLTFSkeletalMeshConverter::Sanitize(const USkeletalMesh*& SkeletalMesh, const USkeletalMeshComponent*& SkeletalMeshComponent, FGLTFMaterialArray& Materials, int32& LODIndex)
+void FGLTFSkeletalMeshConverter::ReleaseMeshSections()
+{
+	MeshSectionConverter.ReleaseOutputs();
+	SharedMeshSectionConverter.ReleaseOutputs();
+	SimplifiedMeshSectionConverter.ReleaseOutputs();
+	PaletteMeshSectionConverter.ReleaseOutputs();
+}
+
+void FGLTFSkeletalMeshConverter::Sanitize(const USkeletalMesh*& SkeletalMesh, const USkeletalMeshComponent*& SkeletalMeshComponent, FGLTFMaterialArray& Materials, int32& LODIndex, int32& PaletteIndex)
 {
 	if (SkeletalMeshComponent != nullptr)
 	{
@@ -75,11 +115,22 @@ void FGLTFSkeletalMeshConverter::Sanitize(const USkeletalMesh*& SkeletalMesh, co
 			SkeletalMeshComponent = nullptr;
 		}
 	}
+
+	// A mesh that isn't split by joint palettes is exported as a whole, regardless of the requested palette
+	const FGLTFJointPalettes* JointPalettes = PaletteIndex != INDEX_NONE ? Builder.GetOrAddJointPalettes(SkeletalMesh, LODIndex) : nullptr;
+	if (JointPalettes == nullptr || JointPalettes->Palettes.Num() <= 1 || !JointPalettes->Palettes.IsValidIndex(PaletteIndex))
+	{
+		PaletteIndex = INDEX_NONE;
+	}
 }
 
-FGLTFJsonMeshIndex FGLTFSkeletalMeshConverter::Convert(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex)
+FGLTFJsonMeshIndex FGLTFSkeletalMeshConverter::Convert(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex, int32 PaletteIndex)
 {
 	const FGLTFJsonMeshIndex MeshIndex = Builder.AddMesh();
-	Builder.SetupTask<FGLTFSkeletalMeshTask>(Builder, MeshSectionConverter, SkeletalMesh, SkeletalMeshComponent, Materials, LODIndex, MeshIndex);
+
+	const FSkeletalMeshLODRenderData& MeshLOD = SkeletalMesh->GetResourceForRendering()->LODRenderData[LODIndex];
+	Builder.MeshSimplificationBudget.AddMesh(MeshIndex, MeshLOD.GetTotalFaces(), SkeletalMesh->GetBounds().SphereRadius);
+
+	Builder.SetupTask<FGLTFSkeletalMeshTask>(Builder, MeshSectionConverter, SharedMeshSectionConverter, SimplifiedMeshSectionConverter, PaletteMeshSectionConverter, SkeletalMesh, SkeletalMeshComponent, Materials, LODIndex, PaletteIndex, MeshIndex);
 	return MeshIndex;
 }
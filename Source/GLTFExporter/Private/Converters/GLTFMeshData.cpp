@@ -23,13 +23,15 @@ FGLTFMeshData::FGLTFMeshData(const UStaticMesh* StaticMesh, const UStaticMeshCom
 		FMeshMergeHelpers::RetrieveMesh(StaticMesh, LODIndex, Description);
 	}
 
+	CompactDescription();
+
 	const int32 NumTexCoords = StaticMesh->GetLODForExport(LODIndex).VertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords();
 	TexCoord = FMath::Min(StaticMesh->LightMapCoordinateIndex, NumTexCoords - 1);
 
 	// TODO: add warning if texture coordinate has overlap
 }
 
-FGLTFMeshData::FGLTFMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex)
+FGLTFMeshData::FGLTFMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex, USkeletalMeshComponent* TransientComponent)
 	: Parent(nullptr)
 {
 	FStaticMeshAttributes(Description).Register();
@@ -43,31 +45,19 @@ FGLTFMeshData::FGLTFMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalM
 	{
 		SkeletalMesh->GetName(Name);
 
-		// NOTE: this is a workaround for the fact that there's no overload for FMeshMergeHelpers::RetrieveMesh
-		// that accepts a USkeletalMesh, only a USkeletalMeshComponent.
-		// Writing a custom utility function that would work on a "standalone" skeletal mesh is problematic
-		// since we would need to implement an equivalent of USkinnedMeshComponent::GetCPUSkinnedVertices too.
+		// NOTE: there's no overload for FMeshMergeHelpers::RetrieveMesh that accepts a USkeletalMesh, only a USkeletalMeshComponent,
+		// which is why the mesh is temporarily assigned to a transient component (shared by all standalone skeletal meshes) instead.
 
-		if (UWorld* World = GEditor->GetEditorWorldContext().World())
+		if (TransientComponent != nullptr)
 		{
-			FActorSpawnParameters SpawnParams;
-			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-			SpawnParams.ObjectFlags |= RF_Transient;
-			SpawnParams.bAllowDuringConstructionScript = true;
-
-			if (AActor* Actor = World->SpawnActor<AActor>(SpawnParams))
-			{
-				USkeletalMeshComponent* Component = NewObject<USkeletalMeshComponent>(Actor, TEXT(""), RF_Transient);
-				Component->RegisterComponent();
-				Component->SetSkeletalMesh(const_cast<USkeletalMesh*>(SkeletalMesh));
-
-				FMeshMergeHelpers::RetrieveMesh(Component, LODIndex, Description, true);
-
-				World->DestroyActor(Actor, false, false);
-			}
+			TransientComponent->SetSkeletalMesh(const_cast<USkeletalMesh*>(SkeletalMesh));
+			FMeshMergeHelpers::RetrieveMesh(TransientComponent, LODIndex, Description, true);
+			TransientComponent->SetSkeletalMesh(nullptr);
 		}
 	}
 
+	CompactDescription();
+
 	// TODO: don't assume last UV channel is non-overlapping
 	const int32 NumTexCoords = SkeletalMesh->GetResourceForRendering()->LODRenderData[LODIndex].StaticVertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords();
 	TexCoord = NumTexCoords - 1;
@@ -79,3 +69,13 @@ const FGLTFMeshData* FGLTFMeshData::GetParent() const
 {
 	return Parent != nullptr ? Parent : this;
 }
+
+void FGLTFMeshData::CompactDescription()
+{
+	// Material baking and UV checks only read positions, vertex instance attributes and polygon groups,
+	// so edge and sharpness attributes are discarded to reduce the memory held for the rest of the export
+	Description.VertexAttributes().UnregisterAttribute(MeshAttribute::Vertex::CornerSharpness);
+	Description.EdgeAttributes().UnregisterAttribute(MeshAttribute::Edge::IsHard);
+	Description.EdgeAttributes().UnregisterAttribute(MeshAttribute::Edge::IsUVSeam);
+	Description.EdgeAttributes().UnregisterAttribute(MeshAttribute::Edge::CreaseSharpness);
+}
@@ -8,7 +8,7 @@
 struct FGLTFMeshData
 {
 	FGLTFMeshData(const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex);
-	FGLTFMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex);
+	FGLTFMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex, USkeletalMeshComponent* TransientComponent);
 
 	const FGLTFMeshData* GetParent() const;
 
@@ -18,4 +18,8 @@ struct FGLTFMeshData
 
 	// TODO: find a better name for referencing the mesh-only data (no component)
 	const FGLTFMeshData* Parent;
+
+private:
+
+	void CompactDescription();
 };
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFMeshDataConverters.h"
+
+TUniquePtr<FGLTFMeshData> FGLTFStaticMeshDataConverter::CreateMeshData(const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex)
+{
+	return MakeUnique<FGLTFMeshData>(StaticMesh, StaticMeshComponent, LODIndex);
+}
+
+FGLTFSkeletalMeshDataConverter::~FGLTFSkeletalMeshDataConverter()
+{
+	if (AActor* Actor = TransientActor.Get())
+	{
+		Actor->GetWorld()->DestroyActor(Actor, false, false);
+	}
+}
+
+TUniquePtr<FGLTFMeshData> FGLTFSkeletalMeshDataConverter::CreateMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex)
+{
+	USkeletalMeshComponent* Component = SkeletalMeshComponent == nullptr ? GetTransientComponent() : nullptr;
+	return MakeUnique<FGLTFMeshData>(SkeletalMesh, SkeletalMeshComponent, LODIndex, Component);
+}
+
+USkeletalMeshComponent* FGLTFSkeletalMeshDataConverter::GetTransientComponent()
+{
+	if (USkeletalMeshComponent* Component = TransientComponent.Get())
+	{
+		return Component;
+	}
+
+	// The actor and component are spawned once and reused for every standalone skeletal mesh, since spawning is relatively expensive
+	if (UWorld* World = GEditor->GetEditorWorldContext().World())
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.bAllowDuringConstructionScript = true;
+
+		if (AActor* Actor = World->SpawnActor<AActor>(SpawnParams))
+		{
+			USkeletalMeshComponent* Component = NewObject<USkeletalMeshComponent>(Actor, TEXT(""), RF_Transient);
+			Component->RegisterComponent();
+
+			TransientActor = Actor;
+			TransientComponent = Component;
+			return Component;
+		}
+	}
+
+	return nullptr;
+}
@@ -4,25 +4,73 @@
 
 #include "Converters/GLTFConverter.h"
 #include "Converters/GLTFMeshData.h"
+#include "Converters/GLTFMeshUtility.h"
 #include "Engine.h"
 
 template <typename MeshType, typename MeshComponentType>
-class TGLTFMeshDataConverter final : public TGLTFConverter<const FGLTFMeshData*, const MeshType*, const MeshComponentType*, int32>
+class TGLTFMeshDataConverter : public TGLTFConverter<const FGLTFMeshData*, const MeshType*, const MeshComponentType*, int32>
 {
-	TArray<TUniquePtr<FGLTFMeshData>> Outputs;
+public:
+
+	// Frees all mesh descriptions, once no task will read them again. The mesh data itself is kept alive since its address is used as key by other converters,
+	// but is no longer returned for subsequent requests (e.g. by later passes of a level export), which retrieve the mesh description again instead.
+	void ReleaseOutputs()
+	{
+		for (const TUniquePtr<FGLTFMeshData>& Output : Outputs)
+		{
+			Output->Description = FMeshDescription();
+		}
+
+		this->ClearSavedOutputs();
+	}
 
-	const FGLTFMeshData* Convert(const MeshType* Mesh, const MeshComponentType* MeshComponent, int32 LODIndex)
+protected:
+
+	virtual void Sanitize(const MeshType*& Mesh, const MeshComponentType*& MeshComponent, int32& LODIndex) override
 	{
-		TUniquePtr<FGLTFMeshData> Output = MakeUnique<FGLTFMeshData>(Mesh, MeshComponent, LODIndex);
+		// Components that don't override any of the retrieved mesh data share the description of the mesh itself
+		if (MeshComponent != nullptr && !FGLTFMeshUtility::HasMeshDataOverrides(MeshComponent, LODIndex))
+		{
+			MeshComponent = nullptr;
+		}
+	}
+
+	virtual const FGLTFMeshData* Convert(const MeshType* Mesh, const MeshComponentType* MeshComponent, int32 LODIndex) override final
+	{
+		TUniquePtr<FGLTFMeshData> Output = CreateMeshData(Mesh, MeshComponent, LODIndex);
 
 		if (MeshComponent != nullptr)
 		{
-			Output->Parent = GetOrAdd(Mesh, nullptr, LODIndex);
+			Output->Parent = this->GetOrAdd(Mesh, nullptr, LODIndex);
 		}
 
 		return Outputs.Add_GetRef(MoveTemp(Output)).Get();
 	}
+
+	virtual TUniquePtr<FGLTFMeshData> CreateMeshData(const MeshType* Mesh, const MeshComponentType* MeshComponent, int32 LODIndex) = 0;
+
+private:
+
+	TArray<TUniquePtr<FGLTFMeshData>> Outputs;
 };
 
-typedef TGLTFMeshDataConverter<UStaticMesh, UStaticMeshComponent> FGLTFStaticMeshDataConverter;
-typedef TGLTFMeshDataConverter<USkeletalMesh, USkeletalMeshComponent> FGLTFSkeletalMeshDataConverter;
+class FGLTFStaticMeshDataConverter final : public TGLTFMeshDataConverter<UStaticMesh, UStaticMeshComponent>
+{
+	virtual TUniquePtr<FGLTFMeshData> CreateMeshData(const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex) override;
+};
+
+class FGLTFSkeletalMeshDataConverter final : public TGLTFMeshDataConverter<USkeletalMesh, USkeletalMeshComponent>
+{
+public:
+
+	virtual ~FGLTFSkeletalMeshDataConverter() override;
+
+private:
+
+	virtual TUniquePtr<FGLTFMeshData> CreateMeshData(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex) override;
+
+	USkeletalMeshComponent* GetTransientComponent();
+
+	TWeakObjectPtr<AActor> TransientActor;
+	TWeakObjectPtr<USkeletalMeshComponent> TransientComponent;
+};
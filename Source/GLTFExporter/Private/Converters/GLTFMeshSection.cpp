@@ -6,6 +6,7 @@
 #include "Algo/MaxElement.h"
 
 FGLTFMeshSection::FGLTFMeshSection(const FStaticMeshLODResources* MeshLOD, const FGLTFIndexArray& SectionIndices)
+	: SectionIndices(SectionIndices)
 {
 	const FStaticMeshLODResources::FStaticMeshSectionArray& Sections = MeshLOD->Sections;
 
@@ -18,14 +19,17 @@ FGLTFMeshSection::FGLTFMeshSection(const FStaticMeshLODResources* MeshLOD, const
 	IndexMap.Reserve(TotalIndexCount);
 	IndexBuffer.AddUninitialized(TotalIndexCount);
 	BoneMapLookup.Reserve(TotalIndexCount);
+	SectionIndexOffsets.Reserve(SectionIndices.Num());
 
 	TMap<uint32, uint32> IndexLookup;
+	uint32 IndexBufferOffset = 0;
 
 	for (int32 SectionIndex : SectionIndices)
 	{
 		const FStaticMeshSection& MeshSection = Sections[SectionIndex];
 		const uint32 IndexOffset = MeshSection.FirstIndex;
 		const uint32 IndexCount = MeshSection.NumTriangles * 3;
+		SectionIndexOffsets.Add(IndexBufferOffset);
 
 		for (uint32 Index = 0; Index < IndexCount; Index++)
 		{
@@ -44,8 +48,10 @@ FGLTFMeshSection::FGLTFMeshSection(const FStaticMeshLODResources* MeshLOD, const
 				BoneMapLookup.Add(0);
 			}
 
-			IndexBuffer[Index] = NewIndex;
+			IndexBuffer[IndexBufferOffset + Index] = NewIndex;
 		}
+
+		IndexBufferOffset += IndexCount;
 	}
 
 	BoneMaps.Add({});
@@ -54,6 +60,7 @@ FGLTFMeshSection::FGLTFMeshSection(const FStaticMeshLODResources* MeshLOD, const
 
 FGLTFMeshSection::FGLTFMeshSection(const FSkeletalMeshLODRenderData* MeshLOD, const FGLTFIndexArray& SectionIndices)
 	: MaxBoneIndex(0)
+	, SectionIndices(SectionIndices)
 {
 	const TArray<FSkelMeshRenderSection>& Sections = MeshLOD->RenderSections;
 
@@ -66,8 +73,10 @@ FGLTFMeshSection::FGLTFMeshSection(const FSkeletalMeshLODRenderData* MeshLOD, co
 	IndexMap.Reserve(TotalIndexCount);
 	IndexBuffer.AddUninitialized(TotalIndexCount);
 	BoneMapLookup.Reserve(TotalIndexCount);
+	SectionIndexOffsets.Reserve(SectionIndices.Num());
 
 	TMap<uint32, uint32> IndexLookup;
+	uint32 IndexBufferOffset = 0;
 
 	const FRawStaticIndexBuffer16or32Interface* OldIndexBuffer = MeshLOD->MultiSizeIndexContainer.GetIndexBuffer();
 
@@ -77,6 +86,7 @@ FGLTFMeshSection::FGLTFMeshSection(const FSkeletalMeshLODRenderData* MeshLOD, co
 		const uint32 IndexOffset = MeshSection.BaseIndex;
 		const uint32 IndexCount = MeshSection.NumTriangles * 3;
 		const uint32 BoneMapIndex = BoneMaps.Num();
+		SectionIndexOffsets.Add(IndexBufferOffset);
 
 		for (uint32 Index = 0; Index < IndexCount; Index++)
 		{
@@ -95,9 +105,11 @@ FGLTFMeshSection::FGLTFMeshSection(const FSkeletalMeshLODRenderData* MeshLOD, co
 				BoneMapLookup.Add(BoneMapIndex);
 			}
 
-			IndexBuffer[Index] = NewIndex;
+			IndexBuffer[IndexBufferOffset + Index] = NewIndex;
 		}
 
+		IndexBufferOffset += IndexCount;
+
 		BoneMaps.Add(MeshSection.BoneMap);
 
 		if (const FBoneIndexType* MaxSectionBoneIndex = Algo::MaxElement(MeshSection.BoneMap))
@@ -106,3 +118,84 @@ FGLTFMeshSection::FGLTFMeshSection(const FSkeletalMeshLODRenderData* MeshLOD, co
 		}
 	}
 }
+
+FGLTFMeshSection::FGLTFMeshSection(const FGLTFMeshSection* VertexSection, const FGLTFIndexArray& SectionIndices)
+	: MaxBoneIndex(VertexSection->MaxBoneIndex)
+	, SectionIndices(SectionIndices)
+{
+	const int32 VertexSectionCount = VertexSection->SectionIndices.Num();
+	const uint32 VertexIndexCount = VertexSection->IndexBuffer.Num();
+
+	SectionIndexOffsets.Reserve(SectionIndices.Num());
+
+	for (int32 SectionIndex : SectionIndices)
+	{
+		const int32 SectionPosition = VertexSection->SectionIndices.Find(SectionIndex);
+		if (SectionPosition == INDEX_NONE)
+		{
+			checkNoEntry();
+			continue;
+		}
+
+		const uint32 IndexOffset = VertexSection->SectionIndexOffsets[SectionPosition];
+		const uint32 IndexEnd = SectionPosition + 1 < VertexSectionCount ? VertexSection->SectionIndexOffsets[SectionPosition + 1] : VertexIndexCount;
+
+		SectionIndexOffsets.Add(IndexBuffer.Num());
+		IndexBuffer.Append(VertexSection->IndexBuffer.GetData() + IndexOffset, IndexEnd - IndexOffset);
+	}
+}
+
+void FGLTFMeshSection::SetSectionIndexBuffers(const TArray<TArray<uint32>>& SectionIndexBuffers)
+{
+	const int32 VertexCount = IndexMap.Num();
+
+	TArray<uint32> VertexRemap;
+	VertexRemap.Init(MAX_uint32, VertexCount);
+
+	for (const TArray<uint32>& Indices : SectionIndexBuffers)
+	{
+		for (const uint32 Index : Indices)
+		{
+			VertexRemap[Index] = 0;
+		}
+	}
+
+	TArray<uint32> NewIndexMap;
+	TArray<uint32> NewBoneMapLookup;
+	NewIndexMap.Reserve(VertexCount);
+	NewBoneMapLookup.Reserve(VertexCount);
+
+	for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		if (VertexRemap[VertexIndex] != MAX_uint32)
+		{
+			VertexRemap[VertexIndex] = NewIndexMap.Num();
+			NewIndexMap.Add(IndexMap[VertexIndex]);
+			NewBoneMapLookup.Add(BoneMapLookup[VertexIndex]);
+		}
+	}
+
+	IndexMap = MoveTemp(NewIndexMap);
+	BoneMapLookup = MoveTemp(NewBoneMapLookup);
+	IndexBuffer.Reset();
+	SectionIndexOffsets.Reset();
+
+	for (const TArray<uint32>& Indices : SectionIndexBuffers)
+	{
+		SectionIndexOffsets.Add(IndexBuffer.Num());
+
+		for (const uint32 Index : Indices)
+		{
+			IndexBuffer.Add(VertexRemap[Index]);
+		}
+	}
+}
+
+void FGLTFMeshSection::Release()
+{
+	IndexMap.Empty();
+	IndexBuffer.Empty();
+	BoneMaps.Empty();
+	BoneMapLookup.Empty();
+	SectionIndexOffsets.Empty();
+}
@@ -10,10 +10,24 @@ struct FGLTFMeshSection
 	FGLTFMeshSection(const FStaticMeshLODResources* MeshLOD, const FGLTFIndexArray& SectionIndices);
 	FGLTFMeshSection(const FSkeletalMeshLODRenderData* MeshLOD, const FGLTFIndexArray& SectionIndices);
 
+	// Creates a section that only has an index buffer, referencing the vertices of a (shared) section that contains all the given section indices.
+	FGLTFMeshSection(const FGLTFMeshSection* VertexSection, const FGLTFIndexArray& SectionIndices);
+
+	// Frees all index and bone data, once no task will read them again. The section itself is kept alive (but no longer returned by its converter)
+	// since its address is used as key by other converters, which would otherwise risk matching a new section allocated at the same address.
+	void Release();
+
+	// Replaces the indices of each source section, and removes all vertices that are no longer referenced (keeping the order of the remaining ones)
+	void SetSectionIndexBuffers(const TArray<TArray<uint32>>& SectionIndexBuffers);
+
 	TArray<uint32> IndexMap;
 	TArray<uint32> IndexBuffer;
 
 	TArray<TArray<FBoneIndexType>> BoneMaps;
 	TArray<uint32> BoneMapLookup;
 	FBoneIndexType MaxBoneIndex;
+
+	// Source sections (of the mesh LOD) and the offset of their first index in IndexBuffer
+	FGLTFIndexArray SectionIndices;
+	TArray<uint32> SectionIndexOffsets;
 };
@@ -4,11 +4,27 @@
 
 #include "Converters/GLTFConverter.h"
 #include "Converters/GLTFMeshSection.h"
+#include "Converters/GLTFMeshSimplificationUtility.h"
+#include "Converters/GLTFJointPaletteUtility.h"
 #include "Converters/GLTFIndexArray.h"
 
 template <typename MeshLODType>
 class TGLTFMeshSectionConverter final : public TGLTFConverter<const FGLTFMeshSection*, const MeshLODType*, FGLTFIndexArray>
 {
+public:
+
+	void ReleaseOutputs()
+	{
+		for (const TUniquePtr<FGLTFMeshSection>& Output : Outputs)
+		{
+			Output->Release();
+		}
+
+		this->ClearSavedOutputs();
+	}
+
+private:
+
 	TArray<TUniquePtr<FGLTFMeshSection>> Outputs;
 
 	const FGLTFMeshSection* Convert(const MeshLODType* MeshLOD, FGLTFIndexArray SectionIndices)
@@ -19,3 +35,79 @@ class TGLTFMeshSectionConverter final : public TGLTFConverter<const FGLTFMeshSec
 
 typedef TGLTFMeshSectionConverter<FStaticMeshLODResources> FGLTFStaticMeshSectionConverter;
 typedef TGLTFMeshSectionConverter<FSkeletalMeshLODRenderData> FGLTFSkeletalMeshSectionConverter;
+
+class FGLTFSharedMeshSectionConverter final : public TGLTFConverter<const FGLTFMeshSection*, const FGLTFMeshSection*, FGLTFIndexArray>
+{
+public:
+
+	void ReleaseOutputs()
+	{
+		for (const TUniquePtr<FGLTFMeshSection>& Output : Outputs)
+		{
+			Output->Release();
+		}
+
+		this->ClearSavedOutputs();
+	}
+
+private:
+
+	TArray<TUniquePtr<FGLTFMeshSection>> Outputs;
+
+	const FGLTFMeshSection* Convert(const FGLTFMeshSection* VertexSection, FGLTFIndexArray SectionIndices)
+	{
+		return Outputs.Add_GetRef(MakeUnique<FGLTFMeshSection>(VertexSection, SectionIndices)).Get();
+	}
+};
+
+class FGLTFSimplifiedMeshSectionConverter final : public TGLTFConverter<const FGLTFMeshSection*, const FGLTFMeshSection*, const FPositionVertexBuffer*, float>
+{
+public:
+
+	void ReleaseOutputs()
+	{
+		for (const TUniquePtr<FGLTFMeshSection>& Output : Outputs)
+		{
+			Output->Release();
+		}
+
+		this->ClearSavedOutputs();
+	}
+
+private:
+
+	TArray<TUniquePtr<FGLTFMeshSection>> Outputs;
+
+	const FGLTFMeshSection* Convert(const FGLTFMeshSection* MeshSection, const FPositionVertexBuffer* PositionBuffer, float Ratio)
+	{
+		FGLTFMeshSection* SimplifiedSection = Outputs.Add_GetRef(MakeUnique<FGLTFMeshSection>(*MeshSection)).Get();
+		FGLTFMeshSimplificationUtility::SimplifySection(*SimplifiedSection, PositionBuffer, Ratio);
+		return SimplifiedSection;
+	}
+};
+
+class FGLTFPaletteMeshSectionConverter final : public TGLTFConverter<const FGLTFMeshSection*, const FGLTFMeshSection*, const FGLTFSkinWeights*, const FGLTFJointPalettes*, int32>
+{
+public:
+
+	void ReleaseOutputs()
+	{
+		for (const TUniquePtr<FGLTFMeshSection>& Output : Outputs)
+		{
+			Output->Release();
+		}
+
+		this->ClearSavedOutputs();
+	}
+
+private:
+
+	TArray<TUniquePtr<FGLTFMeshSection>> Outputs;
+
+	const FGLTFMeshSection* Convert(const FGLTFMeshSection* MeshSection, const FGLTFSkinWeights* SkinWeights, const FGLTFJointPalettes* JointPalettes, int32 PaletteIndex)
+	{
+		FGLTFMeshSection* PaletteSection = Outputs.Add_GetRef(MakeUnique<FGLTFMeshSection>(*MeshSection)).Get();
+		FGLTFJointPaletteUtility::FilterSection(*PaletteSection, *SkinWeights, *JointPalettes, PaletteIndex);
+		return PaletteSection;
+	}
+};
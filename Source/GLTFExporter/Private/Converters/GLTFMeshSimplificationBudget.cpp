@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFMeshSimplificationBudget.h"
+#include "Builders/GLTFConvertBuilder.h"
+
+void FGLTFMeshSimplificationBudget::AddMesh(FGLTFJsonMeshIndex MeshIndex, int32 TriangleCount, float Importance)
+{
+	// Screen coverage is proportional to the squared radius of the bounds
+	const float ScreenImportance = FMath::Max(Importance * Importance, KINDA_SMALL_NUMBER);
+	MeshBudgets.Add(MeshIndex, { TriangleCount, ScreenImportance, 1.0f });
+
+	// Meshes may still be added after distributing (when completing tasks between passes of a level export)
+	bIsDistributed = false;
+}
+
+float FGLTFMeshSimplificationBudget::GetRatio(FGLTFJsonMeshIndex MeshIndex)
+{
+	if (!bIsDistributed)
+	{
+		Distribute();
+		bIsDistributed = true;
+	}
+
+	const FMeshBudget* MeshBudget = MeshBudgets.Find(MeshIndex);
+	return MeshBudget != nullptr ? MeshBudget->Ratio : 1.0f;
+}
+
+void FGLTFMeshSimplificationBudget::Distribute()
+{
+	const float SimplificationRatio = FMath::Clamp(Builder.ExportOptions->MeshSimplificationRatio, 0.0f, 1.0f);
+	const int32 MaximumTriangleCount = Builder.ExportOptions->MaximumMeshTriangleCount;
+	const int32 SceneTriangleBudget = Builder.ExportOptions->SceneTriangleBudget;
+
+	TArray<FMeshBudget*> UncappedBudgets;
+
+	for (TPair<FGLTFJsonMeshIndex, FMeshBudget>& Pair : MeshBudgets)
+	{
+		FMeshBudget& MeshBudget = Pair.Value;
+		MeshBudget.Ratio = SimplificationRatio;
+
+		if (MaximumTriangleCount > 0 && MeshBudget.TriangleCount > MaximumTriangleCount)
+		{
+			MeshBudget.Ratio = FMath::Min(MeshBudget.Ratio, static_cast<float>(MaximumTriangleCount) / MeshBudget.TriangleCount);
+		}
+
+		if (MeshBudget.TriangleCount > 0)
+		{
+			UncappedBudgets.Add(&MeshBudget);
+		}
+	}
+
+	if (SceneTriangleBudget <= 0)
+	{
+		return;
+	}
+
+	// The scene budget is shared in proportion to importance times triangle count, i.e. the ratio kept by each mesh is proportional to its importance.
+	// Meshes whose share exceeds the ratio already given by the options above are capped, and what they leave is redistributed to the remaining meshes.
+	double RemainingTriangleCount = SceneTriangleBudget;
+
+	while (UncappedBudgets.Num() > 0)
+	{
+		double WeightSum = 0;
+		for (const FMeshBudget* MeshBudget : UncappedBudgets)
+		{
+			WeightSum += static_cast<double>(MeshBudget->Importance) * MeshBudget->TriangleCount;
+		}
+
+		const double RatioPerImportance = RemainingTriangleCount / WeightSum;
+		bool bHasCappedBudgets = false;
+
+		for (int32 Index = UncappedBudgets.Num() - 1; Index >= 0; --Index)
+		{
+			const FMeshBudget* MeshBudget = UncappedBudgets[Index];
+			if (RatioPerImportance * MeshBudget->Importance >= MeshBudget->Ratio)
+			{
+				RemainingTriangleCount -= static_cast<double>(MeshBudget->Ratio) * MeshBudget->TriangleCount;
+				UncappedBudgets.RemoveAtSwap(Index);
+				bHasCappedBudgets = true;
+			}
+		}
+
+		if (!bHasCappedBudgets)
+		{
+			for (FMeshBudget* MeshBudget : UncappedBudgets)
+			{
+				MeshBudget->Ratio = static_cast<float>(RatioPerImportance * MeshBudget->Importance);
+			}
+
+			break;
+		}
+	}
+}
@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Json/GLTFJsonIndex.h"
+#include "Converters/GLTFBuilderContext.h"
+#include "CoreMinimal.h"
+
+// Decides how much each exported mesh is simplified, based on the export options and (when using a scene triangle budget) all meshes converted
+class FGLTFMeshSimplificationBudget : public FGLTFBuilderContext
+{
+public:
+
+	FGLTFMeshSimplificationBudget(FGLTFConvertBuilder& Builder)
+		: FGLTFBuilderContext(Builder)
+		, bIsDistributed(false)
+	{
+	}
+
+	// Importance is the bounding sphere radius of the mesh, used as a measure of how much screen space the mesh is likely to cover
+	void AddMesh(FGLTFJsonMeshIndex MeshIndex, int32 TriangleCount, float Importance);
+
+	// Returns the ratio of triangles to keep when exporting the mesh, where 1 means no simplification. When using a scene triangle budget, must not be called until all meshes have been added.
+	float GetRatio(FGLTFJsonMeshIndex MeshIndex);
+
+private:
+
+	struct FMeshBudget
+	{
+		int32 TriangleCount;
+		float Importance;
+		float Ratio;
+	};
+
+	TMap<FGLTFJsonMeshIndex, FMeshBudget> MeshBudgets;
+	bool bIsDistributed;
+
+	void Distribute();
+};
@@ -0,0 +1,363 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFMeshSimplificationUtility.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// Symmetric error quadric (Garland & Heckbert), summing the squared distances from a point to a set of (area-weighted) planes
+	struct FQuadric
+	{
+		double A00, A01, A02, A11, A12, A22;
+		double B0, B1, B2;
+		double C;
+
+		FQuadric()
+			: A00(0), A01(0), A02(0), A11(0), A12(0), A22(0)
+			, B0(0), B1(0), B2(0)
+			, C(0)
+		{
+		}
+
+		FQuadric(const FVector& Normal, double Distance, double Weight)
+			: A00(Weight * Normal.X * Normal.X), A01(Weight * Normal.X * Normal.Y), A02(Weight * Normal.X * Normal.Z)
+			, A11(Weight * Normal.Y * Normal.Y), A12(Weight * Normal.Y * Normal.Z), A22(Weight * Normal.Z * Normal.Z)
+			, B0(Weight * Normal.X * Distance), B1(Weight * Normal.Y * Distance), B2(Weight * Normal.Z * Distance)
+			, C(Weight * Distance * Distance)
+		{
+		}
+
+		FQuadric& operator+=(const FQuadric& Other)
+		{
+			A00 += Other.A00; A01 += Other.A01; A02 += Other.A02;
+			A11 += Other.A11; A12 += Other.A12; A22 += Other.A22;
+			B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+			C += Other.C;
+			return *this;
+		}
+
+		double Evaluate(const FVector& Point) const
+		{
+			const double X = Point.X;
+			const double Y = Point.Y;
+			const double Z = Point.Z;
+
+			const double Error =
+				A00 * X * X + A11 * Y * Y + A22 * Z * Z +
+				2 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z) +
+				2 * (B0 * X + B1 * Y + B2 * Z) +
+				C;
+
+			// Error may become slightly negative due to precision issues
+			return FMath::Abs(Error);
+		}
+	};
+
+	struct FEdgeCollapse
+	{
+		uint32 Vertex; // Removed by the collapse
+		uint32 Target; // Takes the place of the removed vertex
+		double Error;
+	};
+
+	uint64 MakeEdgeKey(uint32 A, uint32 B)
+	{
+		return A < B ? (static_cast<uint64>(A) << 32) | B : (static_cast<uint64>(B) << 32) | A;
+	}
+
+	FVector GetTriangleNormal(const FVector& A, const FVector& B, const FVector& C)
+	{
+		return (B - A) ^ (C - A);
+	}
+}
+
+void FGLTFMeshSimplificationUtility::SimplifySection(FGLTFMeshSection& MeshSection, const FPositionVertexBuffer* PositionBuffer, float Ratio)
+{
+	const int32 VertexCount = MeshSection.IndexMap.Num();
+
+	TArray<FVector> Positions;
+	Positions.AddUninitialized(VertexCount);
+
+	for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		Positions[VertexIndex] = PositionBuffer->VertexPosition(MeshSection.IndexMap[VertexIndex]);
+	}
+
+	const int32 SectionCount = MeshSection.SectionIndexOffsets.Num();
+	const uint32 IndexCount = MeshSection.IndexBuffer.Num();
+
+	TArray<TArray<uint32>> SectionIndexBuffers;
+	SectionIndexBuffers.SetNum(SectionCount);
+
+	// Each source section is simplified separately, which keeps the borders between sections (i.e. materials) intact
+	ParallelFor(SectionCount, [&MeshSection, &Positions, &SectionIndexBuffers, SectionCount, IndexCount, Ratio](int32 SectionPosition)
+	{
+		const uint32 IndexOffset = MeshSection.SectionIndexOffsets[SectionPosition];
+		const uint32 IndexEnd = SectionPosition + 1 < SectionCount ? MeshSection.SectionIndexOffsets[SectionPosition + 1] : IndexCount;
+
+		TArray<uint32>& Indices = SectionIndexBuffers[SectionPosition];
+		Indices.Append(MeshSection.IndexBuffer.GetData() + IndexOffset, IndexEnd - IndexOffset);
+
+		const int32 TargetTriangleCount = FMath::CeilToInt(Indices.Num() / 3 * Ratio);
+		SimplifyIndices(Positions, Indices, TargetTriangleCount);
+	}, SectionCount == 1);
+
+	// Remove all vertices that are no longer referenced, keeping the order of the remaining ones
+	MeshSection.SetSectionIndexBuffers(SectionIndexBuffers);
+}
+
+void FGLTFMeshSimplificationUtility::SimplifyIndices(const TArray<FVector>& Positions, TArray<uint32>& Indices, int32 TargetTriangleCount)
+{
+	int32 TriangleCount = Indices.Num() / 3;
+	if (TriangleCount <= TargetTriangleCount)
+	{
+		return;
+	}
+
+	const int32 VertexCount = Positions.Num();
+
+	// Vertices that share a position (i.e. only differ in other attributes) are welded, so that seams can be detected
+	TMap<FVector, uint32> PositionLookup;
+	TArray<uint32> PositionIds;
+	PositionIds.AddUninitialized(VertexCount);
+
+	for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		const FVector& Position = Positions[VertexIndex];
+
+		if (const uint32* FoundId = PositionLookup.Find(Position))
+		{
+			PositionIds[VertexIndex] = *FoundId;
+		}
+		else
+		{
+			const uint32 PositionId = PositionLookup.Num();
+			PositionLookup.Add(Position, PositionId);
+			PositionIds[VertexIndex] = PositionId;
+		}
+	}
+
+	const int32 PositionCount = PositionLookup.Num();
+
+	// Positions shared by multiple referenced vertices lie on a seam, and are locked to avoid tearing the seam open
+	TArray<bool> ReferencedVertices;
+	TArray<int32> PositionVertexCounts;
+	ReferencedVertices.Init(false, VertexCount);
+	PositionVertexCounts.Init(0, PositionCount);
+
+	for (const uint32 Index : Indices)
+	{
+		if (!ReferencedVertices[Index])
+		{
+			ReferencedVertices[Index] = true;
+			PositionVertexCounts[PositionIds[Index]]++;
+		}
+	}
+
+	TArray<bool> LockedPositions;
+	LockedPositions.AddUninitialized(PositionCount);
+
+	for (int32 PositionId = 0; PositionId < PositionCount; ++PositionId)
+	{
+		LockedPositions[PositionId] = PositionVertexCounts[PositionId] > 1;
+	}
+
+	// Positions on an open border (an edge used by a single triangle) are also locked, to preserve the outline of the surface
+	TMap<uint64, int32> EdgeTriangleCounts;
+
+	for (int32 TriangleIndex = 0; TriangleIndex < TriangleCount; ++TriangleIndex)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 A = PositionIds[Indices[TriangleIndex * 3 + Corner]];
+			const uint32 B = PositionIds[Indices[TriangleIndex * 3 + (Corner + 1) % 3]];
+			EdgeTriangleCounts.FindOrAdd(MakeEdgeKey(A, B))++;
+		}
+	}
+
+	for (const TPair<uint64, int32>& EdgeTriangleCount : EdgeTriangleCounts)
+	{
+		if (EdgeTriangleCount.Value == 1)
+		{
+			LockedPositions[static_cast<uint32>(EdgeTriangleCount.Key >> 32)] = true;
+			LockedPositions[static_cast<uint32>(EdgeTriangleCount.Key & MAX_uint32)] = true;
+		}
+	}
+
+	TArray<FQuadric> Quadrics;
+	Quadrics.SetNum(PositionCount);
+
+	for (int32 TriangleIndex = 0; TriangleIndex < TriangleCount; ++TriangleIndex)
+	{
+		const FVector& A = Positions[Indices[TriangleIndex * 3 + 0]];
+		const FVector& B = Positions[Indices[TriangleIndex * 3 + 1]];
+		const FVector& C = Positions[Indices[TriangleIndex * 3 + 2]];
+
+		const FVector Normal = GetTriangleNormal(A, B, C);
+		const float DoubleArea = Normal.Size();
+		if (DoubleArea <= SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const FVector UnitNormal = Normal / DoubleArea;
+		const FQuadric Quadric(UnitNormal, -(UnitNormal | A), DoubleArea * 0.5);
+
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			Quadrics[PositionIds[Indices[TriangleIndex * 3 + Corner]]] += Quadric;
+		}
+	}
+
+	TArray<int32> AdjacencyOffsets;
+	TArray<int32> AdjacentTriangles;
+	TArray<FEdgeCollapse> Collapses;
+	TArray<uint32> VertexRemap;
+	TArray<bool> TouchedVertices;
+
+	// Each pass collapses the cheapest edges first, but only touches each vertex once, after which the index buffer is remapped and compacted
+	while (TriangleCount > TargetTriangleCount)
+	{
+		AdjacencyOffsets.Init(0, VertexCount + 1);
+
+		for (const uint32 Index : Indices)
+		{
+			AdjacencyOffsets[Index + 1]++;
+		}
+
+		for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+		{
+			AdjacencyOffsets[VertexIndex + 1] += AdjacencyOffsets[VertexIndex];
+		}
+
+		AdjacentTriangles.SetNumUninitialized(Indices.Num(), false);
+		TArray<int32> AdjacencyCursors = AdjacencyOffsets;
+
+		for (int32 Index = 0; Index < Indices.Num(); ++Index)
+		{
+			AdjacentTriangles[AdjacencyCursors[Indices[Index]]++] = Index / 3;
+		}
+
+		Collapses.Reset();
+
+		auto AddCollapse = [&](uint32 Vertex, uint32 Target)
+		{
+			const uint32 PositionId = PositionIds[Vertex];
+			const uint32 TargetPositionId = PositionIds[Target];
+
+			if (!LockedPositions[PositionId] && PositionId != TargetPositionId)
+			{
+				const FVector& TargetPosition = Positions[Target];
+				const double Error = Quadrics[PositionId].Evaluate(TargetPosition) + Quadrics[TargetPositionId].Evaluate(TargetPosition);
+				Collapses.Add({ Vertex, Target, Error });
+			}
+		};
+
+		for (int32 TriangleIndex = 0; TriangleIndex < TriangleCount; ++TriangleIndex)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 A = Indices[TriangleIndex * 3 + Corner];
+				const uint32 B = Indices[TriangleIndex * 3 + (Corner + 1) % 3];
+				AddCollapse(A, B);
+				AddCollapse(B, A);
+			}
+		}
+
+		Collapses.Sort([](const FEdgeCollapse& A, const FEdgeCollapse& B)
+		{
+			return A.Error < B.Error;
+		});
+
+		VertexRemap.SetNumUninitialized(VertexCount, false);
+		for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+		{
+			VertexRemap[VertexIndex] = VertexIndex;
+		}
+
+		TouchedVertices.Init(false, VertexCount);
+
+		const int32 RemovableCount = TriangleCount - TargetTriangleCount;
+		int32 RemovedCount = 0;
+
+		for (const FEdgeCollapse& Collapse : Collapses)
+		{
+			if (RemovedCount >= RemovableCount)
+			{
+				break;
+			}
+
+			if (TouchedVertices[Collapse.Vertex] || TouchedVertices[Collapse.Target])
+			{
+				continue;
+			}
+
+			// Reject the collapse if it would flip any of the remaining triangles around the removed vertex
+			bool bFlipsTriangle = false;
+			int32 CollapsedCount = 0;
+
+			for (int32 Adjacency = AdjacencyOffsets[Collapse.Vertex]; Adjacency < AdjacencyOffsets[Collapse.Vertex + 1]; ++Adjacency)
+			{
+				const int32 TriangleIndex = AdjacentTriangles[Adjacency];
+				const uint32 A = VertexRemap[Indices[TriangleIndex * 3 + 0]];
+				const uint32 B = VertexRemap[Indices[TriangleIndex * 3 + 1]];
+				const uint32 C = VertexRemap[Indices[TriangleIndex * 3 + 2]];
+
+				if (A == Collapse.Target || B == Collapse.Target || C == Collapse.Target)
+				{
+					CollapsedCount++;
+					continue;
+				}
+
+				const FVector OldNormal = GetTriangleNormal(Positions[A], Positions[B], Positions[C]);
+				const FVector NewNormal = GetTriangleNormal(
+					Positions[A == Collapse.Vertex ? Collapse.Target : A],
+					Positions[B == Collapse.Vertex ? Collapse.Target : B],
+					Positions[C == Collapse.Vertex ? Collapse.Target : C]);
+
+				if ((OldNormal | NewNormal) <= 0)
+				{
+					bFlipsTriangle = true;
+					break;
+				}
+			}
+
+			if (bFlipsTriangle)
+			{
+				continue;
+			}
+
+			VertexRemap[Collapse.Vertex] = Collapse.Target;
+			TouchedVertices[Collapse.Vertex] = true;
+			TouchedVertices[Collapse.Target] = true;
+
+			Quadrics[PositionIds[Collapse.Target]] += Quadrics[PositionIds[Collapse.Vertex]];
+			RemovedCount += CollapsedCount;
+		}
+
+		if (RemovedCount == 0)
+		{
+			// No edge can be collapsed without flipping triangles or moving locked vertices
+			break;
+		}
+
+		int32 IndexCount = 0;
+
+		for (int32 TriangleIndex = 0; TriangleIndex < TriangleCount; ++TriangleIndex)
+		{
+			const uint32 A = VertexRemap[Indices[TriangleIndex * 3 + 0]];
+			const uint32 B = VertexRemap[Indices[TriangleIndex * 3 + 1]];
+			const uint32 C = VertexRemap[Indices[TriangleIndex * 3 + 2]];
+
+			if (A != B && B != C && C != A)
+			{
+				Indices[IndexCount++] = A;
+				Indices[IndexCount++] = B;
+				Indices[IndexCount++] = C;
+			}
+		}
+
+		Indices.SetNum(IndexCount, false);
+		TriangleCount = IndexCount / 3;
+	}
+}
@@ -0,0 +1,16 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Converters/GLTFMeshSection.h"
+#include "Engine.h"
+
+struct FGLTFMeshSimplificationUtility
+{
+	// Simplifies the triangles of each source section (of the given mesh section) separately and in parallel, then removes all unreferenced vertices
+	static void SimplifySection(FGLTFMeshSection& MeshSection, const FPositionVertexBuffer* PositionBuffer, float Ratio);
+
+	// Reduces the triangle list towards the target count by collapsing edges in order of quadric error. Vertices are never moved, only merged into neighbouring
+	// vertices, which preserves all of their attributes. Vertices on UV (or other attribute) seams and on open borders are locked in place.
+	static void SimplifyIndices(const TArray<FVector>& Positions, TArray<uint32>& Indices, int32 TargetTriangleCount);
+};
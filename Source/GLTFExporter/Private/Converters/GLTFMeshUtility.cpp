@@ -2,6 +2,7 @@
 
 #include "Converters/GLTFMeshUtility.h"
 #include "Rendering/SkeletalMeshRenderData.h"
+#include "Components/SplineMeshComponent.h"
 #include "PlatformInfo.h"
 
 FGLTFIndexArray FGLTFMeshUtility::GetSectionIndices(const FStaticMeshLODResources& MeshLOD, int32 MaterialIndex)
@@ -40,6 +41,32 @@ FGLTFIndexArray FGLTFMeshUtility::GetSectionIndices(const FSkeletalMeshLODRender
 	return SectionIndices;
 }
 
+FGLTFIndexArray FGLTFMeshUtility::GetAllSectionIndices(const FStaticMeshLODResources& MeshLOD)
+{
+	FGLTFIndexArray SectionIndices;
+	SectionIndices.AddUninitialized(MeshLOD.Sections.Num());
+
+	for (int32 SectionIndex = 0; SectionIndex < SectionIndices.Num(); ++SectionIndex)
+	{
+		SectionIndices[SectionIndex] = SectionIndex;
+	}
+
+	return SectionIndices;
+}
+
+FGLTFIndexArray FGLTFMeshUtility::GetAllSectionIndices(const FSkeletalMeshLODRenderData& MeshLOD)
+{
+	FGLTFIndexArray SectionIndices;
+	SectionIndices.AddUninitialized(MeshLOD.RenderSections.Num());
+
+	for (int32 SectionIndex = 0; SectionIndex < SectionIndices.Num(); ++SectionIndex)
+	{
+		SectionIndices[SectionIndex] = SectionIndex;
+	}
+
+	return SectionIndices;
+}
+
 int32 FGLTFMeshUtility::GetLOD(const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, int32 DefaultLOD)
 {
 	const int32 ForcedLOD = StaticMeshComponent != nullptr ? StaticMeshComponent->ForcedLodModel - 1 : -1;
@@ -103,6 +130,69 @@ int32 FGLTFMeshUtility::GetMinimumLOD(const USkeletalMesh* SkeletalMesh, const U
 	return -1;
 }
 
+float FGLTFMeshUtility::GetScreenSize(const UStaticMesh* StaticMesh, int32 LODIndex)
+{
+	if (StaticMesh != nullptr && StaticMesh->RenderData.IsValid() && LODIndex >= 0 && LODIndex < MAX_STATIC_MESH_LODS)
+	{
+		return GetValueForRunningPlatform<float>(StaticMesh->RenderData->ScreenSize[LODIndex]);
+	}
+
+	return 0;
+}
+
+float FGLTFMeshUtility::GetScreenSize(const USkeletalMesh* SkeletalMesh, int32 LODIndex)
+{
+	if (SkeletalMesh != nullptr)
+	{
+		if (const FSkeletalMeshLODInfo* LODInfo = SkeletalMesh->GetLODInfo(LODIndex))
+		{
+			return GetValueForRunningPlatform<float>(LODInfo->ScreenSize);
+		}
+	}
+
+	return 0;
+}
+
+TArray<const UMorphTarget*> FGLTFMeshUtility::GetMorphTargets(const USkeletalMesh* SkeletalMesh)
+{
+	TArray<const UMorphTarget*> MorphTargets;
+
+	if (SkeletalMesh != nullptr)
+	{
+		for (const UMorphTarget* MorphTarget : SkeletalMesh->MorphTargets)
+		{
+			if (MorphTarget != nullptr)
+			{
+				MorphTargets.Add(MorphTarget);
+			}
+		}
+	}
+
+	return MorphTargets;
+}
+
+bool FGLTFMeshUtility::HasMeshDataOverrides(const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex)
+{
+	if (StaticMeshComponent->IsA<USplineMeshComponent>())
+	{
+		return true;
+	}
+
+	const TArray<FStaticMeshComponentLODInfo>& LODData = StaticMeshComponent->LODData;
+	return LODData.IsValidIndex(LODIndex) && LODData[LODIndex].OverrideVertexColors != nullptr;
+}
+
+bool FGLTFMeshUtility::HasMeshDataOverrides(const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex)
+{
+	if (SkeletalMeshComponent->IsUsingSkinWeightProfile())
+	{
+		return true;
+	}
+
+	const TArray<FSkelMeshComponentLODInfo>& LODInfo = SkeletalMeshComponent->LODInfo;
+	return LODInfo.IsValidIndex(LODIndex) && (LODInfo[LODIndex].OverrideVertexColors != nullptr || LODInfo[LODIndex].OverrideSkinWeights != nullptr);
+}
+
 template <typename ValueType, typename StructType>
 ValueType FGLTFMeshUtility::GetValueForRunningPlatform(const StructType& Properties)
 {
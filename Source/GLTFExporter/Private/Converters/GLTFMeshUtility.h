@@ -12,6 +12,9 @@ struct FGLTFMeshUtility
 	static FGLTFIndexArray GetSectionIndices(const FStaticMeshLODResources& MeshLOD, int32 MaterialIndex);
 	static FGLTFIndexArray GetSectionIndices(const FSkeletalMeshLODRenderData& MeshLOD, int32 MaterialIndex);
 
+	static FGLTFIndexArray GetAllSectionIndices(const FStaticMeshLODResources& MeshLOD);
+	static FGLTFIndexArray GetAllSectionIndices(const FSkeletalMeshLODRenderData& MeshLOD);
+
 	static int32 GetLOD(const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, int32 DefaultLOD);
 	static int32 GetLOD(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, int32 DefaultLOD);
 
@@ -21,6 +24,15 @@ struct FGLTFMeshUtility
 	static int32 GetMinimumLOD(const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent);
 	static int32 GetMinimumLOD(const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent);
 
+	static float GetScreenSize(const UStaticMesh* StaticMesh, int32 LODIndex);
+	static float GetScreenSize(const USkeletalMesh* SkeletalMesh, int32 LODIndex);
+
+	static TArray<const UMorphTarget*> GetMorphTargets(const USkeletalMesh* SkeletalMesh);
+
+	// Returns true if the component overrides any of the mesh data (e.g. vertex colors or skin weights) that is retrieved for the given LOD
+	static bool HasMeshDataOverrides(const UStaticMeshComponent* StaticMeshComponent, int32 LODIndex);
+	static bool HasMeshDataOverrides(const USkeletalMeshComponent* SkeletalMeshComponent, int32 LODIndex);
+
 private:
 
 	template <typename ValueType, typename StructType>
@@ -5,8 +5,61 @@
 #include "Converters/GLTFConverterUtility.h"
 #include "Converters/GLTFActorUtility.h"
 #include "Converters/GLTFNameUtility.h"
+#include "Converters/GLTFMeshUtility.h"
+#include "Converters/GLTFInstancingUtility.h"
+#include "Converters/GLTFJointPaletteUtility.h"
 #include "Actors/GLTFHotspotActor.h"
 #include "LevelSequenceActor.h"
+#include "Animation/MorphTarget.h"
+
+namespace
+{
+	template <typename MeshType, typename GetMeshFunctionType>
+	void SetNodeMeshLODs(FGLTFConvertBuilder& Builder, FGLTFJsonNodeIndex NodeIndex, const MeshType* Mesh, int32 BaseLOD, bool bAllowLODs, GetMeshFunctionType GetMesh, TArray<FGLTFJsonNodeIndex>& OutMeshNodeIndices)
+	{
+		int32 LastLOD = FGLTFMeshUtility::GetMaximumLOD(Mesh);
+		if (Builder.ExportOptions->MaximumLevelOfDetail >= 0)
+		{
+			LastLOD = FMath::Min(LastLOD, Builder.ExportOptions->MaximumLevelOfDetail);
+		}
+
+		if (!bAllowLODs || !Builder.ExportOptions->bExportLevelsOfDetail || LastLOD <= BaseLOD)
+		{
+			OutMeshNodeIndices.Add(Builder.SetNodeMesh(NodeIndex, GetMesh(BaseLOD)));
+			return;
+		}
+
+		// Levels of detail replace the whole node (including its children) in viewers, so they need a separate node
+		FGLTFJsonNode LODNode;
+		LODNode.Name = Builder.GetNode(NodeIndex).Name;
+
+		const FGLTFJsonNodeIndex BaseNodeIndex = Builder.AddChildNode(NodeIndex, LODNode);
+		OutMeshNodeIndices.Add(Builder.SetNodeMesh(BaseNodeIndex, GetMesh(BaseLOD)));
+
+		TArray<FGLTFJsonNodeIndex> LODs;
+		TArray<float> LODScreenCoverages;
+
+		for (int32 LODIndex = BaseLOD + 1; LODIndex <= LastLOD; ++LODIndex)
+		{
+			// Nodes of lower levels are referenced by the extension only, i.e. not part of the node hierarchy
+			const FGLTFJsonNodeIndex LevelNodeIndex = Builder.AddNode(LODNode);
+			OutMeshNodeIndices.Add(Builder.SetNodeMesh(LevelNodeIndex, GetMesh(LODIndex)));
+			LODs.Add(LevelNodeIndex);
+		}
+
+		for (int32 LODIndex = BaseLOD; LODIndex <= LastLOD; ++LODIndex)
+		{
+			// Screen size is the diameter of the bounds relative to the screen, so squaring it approximates the screen coverage.
+			// Each level is used until the next level's screen size is reached, while the last level is never culled.
+			const float ScreenSize = LODIndex < LastLOD ? FGLTFMeshUtility::GetScreenSize(Mesh, LODIndex + 1) : 0;
+			LODScreenCoverages.Add(FMath::Square(ScreenSize));
+		}
+
+		FGLTFJsonNode& BaseNode = Builder.GetNode(BaseNodeIndex);
+		BaseNode.LODs = LODs;
+		BaseNode.LODScreenCoverages = LODScreenCoverages;
+	}
+}
 
 FGLTFJsonNodeIndex FGLTFActorConverter::Convert(const AActor* Actor)
 {
@@ -117,32 +170,141 @@ FGLTFJsonNodeIndex FGLTFComponentConverter::Convert(const USceneComponent* Scene
 	// TODO: should hidden in game be configurable like this?
 	if (!SceneComponent->bHiddenInGame || Builder.ExportOptions->bExportHiddenInGame)
 	{
-		if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent))
+		const UInstancedStaticMeshComponent* InstancedMeshComponent = Cast<UInstancedStaticMeshComponent>(SceneComponent);
+		if (InstancedMeshComponent != nullptr && Builder.ExportOptions->bExportMeshInstances)
+		{
+			TArray<FTransform> InstanceTransforms;
+			FGLTFInstancingUtility::GetInstanceTransforms(InstancedMeshComponent, InstanceTransforms);
+
+			if (InstanceTransforms.Num() > 0)
+			{
+				// Instance transforms are applied before any node transform, which rules out a separate node for dequantization or levels of detail
+				Node.Mesh = Builder.GetOrAddMesh(InstancedMeshComponent);
+				FGLTFInstancingUtility::SetNodeInstances(Builder, NodeIndex, InstanceTransforms);
+
+				// NOTE: each instance samples its own region of the lightmap, which EPIC_lightmap_textures can't express per instance
+				if (Builder.ExportOptions->bExportLightmaps &&
+					InstancedMeshComponent->LODData.Num() > 0 &&
+					InstancedMeshComponent->GetMeshMapBuildData(InstancedMeshComponent->LODData[0]) != nullptr)
+				{
+					Builder.AddWarningMessage(FString::Printf(
+						TEXT("Instanced mesh component %s (in actor %s) will be exported without its lightmap, since lightmaps of instances are not supported"),
+						*SceneComponent->GetName(),
+						*Owner->GetName()));
+				}
+			}
+		}
+		else if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent))
 		{
-			Node.Mesh = Builder.GetOrAddMesh(StaticMeshComponent);
+			// Mesh variants replace the mesh of the component node, which would leave any separate node (for dequantization or levels of detail) behind
+			const bool bSeparateMeshNode = !Builder.ExportOptions->bExportVariantSets;
+			const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+			const int32 BaseLOD = FGLTFMeshUtility::GetLOD(StaticMesh, StaticMeshComponent, Builder.ExportOptions->DefaultLevelOfDetail);
+
+			TArray<FGLTFJsonNodeIndex> MeshNodeIndices;
+			SetNodeMeshLODs(Builder, NodeIndex, StaticMesh, BaseLOD, bSeparateMeshNode, [this, StaticMeshComponent, bSeparateMeshNode](int32 LODIndex)
+			{
+				return Builder.GetOrAddMesh(StaticMeshComponent, {}, LODIndex, bSeparateMeshNode);
+			}, MeshNodeIndices);
 
 			if (Builder.ExportOptions->bExportLightmaps)
 			{
-				Node.LightMap = Builder.GetOrAddLightMap(StaticMeshComponent);
+				// Mesh nodes are ordered by level of detail, starting at the base LOD
+				for (int32 LODOffset = 0; LODOffset < MeshNodeIndices.Num(); ++LODOffset)
+				{
+					Builder.GetNode(MeshNodeIndices[LODOffset]).LightMap = Builder.GetOrAddLightMap(StaticMeshComponent, BaseLOD + LODOffset);
+				}
 			}
 		}
 		else if (const USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(SceneComponent))
 		{
-			Node.Mesh = Builder.GetOrAddMesh(SkeletalMeshComponent);
+			const bool bSeparateMeshNode = !Builder.ExportOptions->bExportVariantSets;
+			const USkeletalMesh* SkeletalMesh = SkeletalMeshComponent->SkeletalMesh;
+			const int32 BaseLOD = FGLTFMeshUtility::GetLOD(SkeletalMesh, SkeletalMeshComponent, Builder.ExportOptions->DefaultLevelOfDetail);
+
+			// Splitting by joint palettes adds separate mesh nodes too, and each palette is only used when the mesh actually needs more than one
+			const bool bSplitJointPalettes = bSeparateMeshNode && FGLTFJointPaletteUtility::CanSplitMesh(Builder, SkeletalMeshComponent);
+
+			TArray<FGLTFJsonNodeIndex> MeshNodeIndices;
+			SetNodeMeshLODs(Builder, NodeIndex, SkeletalMesh, BaseLOD, bSeparateMeshNode, [this, SkeletalMeshComponent, bSplitJointPalettes](int32 LODIndex)
+			{
+				return Builder.GetOrAddMesh(SkeletalMeshComponent, {}, LODIndex, bSplitJointPalettes ? 0 : INDEX_NONE);
+			}, MeshNodeIndices);
+
+			TArray<const FGLTFSkinJoints*> MeshNodePalettes;
+
+			if (bSplitJointPalettes)
+			{
+				// Mesh nodes are ordered by level of detail, starting at the base LOD
+				TArray<FGLTFJsonNodeIndex> LODNodeIndices = MoveTemp(MeshNodeIndices);
+				for (int32 LODOffset = 0; LODOffset < LODNodeIndices.Num(); ++LODOffset)
+				{
+					FGLTFJointPaletteUtility::AddPaletteNodes(Builder, LODNodeIndices[LODOffset], SkeletalMesh, SkeletalMeshComponent, BaseLOD + LODOffset, MeshNodeIndices, MeshNodePalettes);
+				}
+			}
+			else
+			{
+				MeshNodePalettes.Init(nullptr, MeshNodeIndices.Num());
+			}
+
+			if (Builder.ExportOptions->bExportMorphTargets)
+			{
+				TArray<float> MorphTargetWeights;
+				bool bHasWeights = false;
+
+				for (const UMorphTarget* MorphTarget : FGLTFMeshUtility::GetMorphTargets(SkeletalMesh))
+				{
+					const float Weight = SkeletalMeshComponent->GetMorphTarget(MorphTarget->GetFName());
+					MorphTargetWeights.Add(Weight);
+					bHasWeights |= Weight != 0;
+				}
+
+				// Weights are set on the nodes since the mesh may be shared by components with different weights
+				if (bHasWeights)
+				{
+					for (const FGLTFJsonNodeIndex MeshNodeIndex : MeshNodeIndices)
+					{
+						Builder.GetNode(MeshNodeIndex).Weights = MorphTargetWeights;
+					}
+				}
+			}
 
 			if (Builder.ExportOptions->bExportVertexSkinWeights)
 			{
 				// TODO: remove need for NodeIndex by adding support for cyclic calls in converter
-				const FGLTFJsonSkinIndex SkinIndex = Builder.GetOrAddSkin(NodeIndex, SkeletalMeshComponent);
-				if (SkinIndex != INDEX_NONE)
+				FGLTFJsonNodeIndex SkinRootNode = NodeIndex;
+				const USkeletalMesh* SkinRootMesh = SkeletalMesh;
+
+				// Components that follow the pose of an ancestor component (e.g. modular characters) share its joint nodes, and its skin too when their bones
+				// are identical. Only ancestors are considered, since their nodes are always converted first.
+				const USkeletalMeshComponent* LeaderComponent = Cast<USkeletalMeshComponent>(SkeletalMeshComponent->MasterPoseComponent.Get());
+				if (LeaderComponent != nullptr && LeaderComponent->SkeletalMesh != nullptr && SkeletalMeshComponent->IsAttachedTo(LeaderComponent))
 				{
-					Builder.GetNode(NodeIndex).Skin = SkinIndex;
+					const FGLTFJsonNodeIndex LeaderNodeIndex = Builder.GetOrAddNode(LeaderComponent);
+					if (LeaderNodeIndex != INDEX_NONE)
+					{
+						SkinRootNode = LeaderNodeIndex;
+						SkinRootMesh = LeaderComponent->SkeletalMesh;
+					}
+				}
 
-					if (Builder.ExportOptions->bExportAnimationSequences)
+				bool bHasSkin = false;
+
+				for (int32 Index = 0; Index < MeshNodeIndices.Num(); ++Index)
+				{
+					const FGLTFJsonSkinIndex SkinIndex = Builder.GetOrAddSkin(SkinRootNode, SkeletalMeshComponent, MeshNodePalettes[Index], SkinRootMesh);
+					if (SkinIndex != INDEX_NONE)
 					{
-						Builder.GetOrAddAnimation(NodeIndex, SkeletalMeshComponent);
+						Builder.GetNode(MeshNodeIndices[Index]).Skin = SkinIndex;
+						bHasSkin = true;
 					}
 				}
+
+				// Joints shared with a leader component are animated by the leader
+				if (bHasSkin && SkinRootNode == NodeIndex && Builder.ExportOptions->bExportAnimationSequences)
+				{
+					Builder.GetOrAddAnimation(NodeIndex, SkeletalMeshComponent);
+				}
 			}
 		}
 		else if (const UCameraComponent* CameraComponent = Cast<UCameraComponent>(SceneComponent))
@@ -254,8 +416,6 @@ FGLTFJsonNodeIndex FGLTFSkeletalSocketConverter::Convert(FGLTFJsonNodeIndex Root
 
 FGLTFJsonNodeIndex FGLTFSkeletalBoneConverter::Convert(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, int32 BoneIndex)
 {
-	// TODO: add support for MasterPoseComponent?
-
 	const TArray<FMeshBoneInfo>& BoneInfos = SkeletalMesh->RefSkeleton.GetRefBoneInfo();
 	if (!BoneInfos.IsValidIndex(BoneIndex))
 	{
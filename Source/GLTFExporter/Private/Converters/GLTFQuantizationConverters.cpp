@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFQuantizationConverters.h"
+#include "Converters/GLTFConverterUtility.h"
+#include "Builders/GLTFConvertBuilder.h"
+
+FGLTFPositionQuantization FGLTFPositionQuantizationConverter::Convert(const FPositionVertexBuffer* VertexBuffer)
+{
+	FGLTFPositionQuantization Quantization;
+
+	const uint32 VertexCount = VertexBuffer->GetNumVertices();
+	if (VertexCount == 0)
+	{
+		return Quantization;
+	}
+
+	FBox Bounds(ForceInit);
+
+	for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		Bounds += VertexBuffer->VertexPosition(VertexIndex);
+	}
+
+	// Avoid a zero scale (and thereby a degenerate node transform) for flat meshes
+	const FVector Extent = Bounds.GetExtent().ComponentMax(FVector(KINDA_SMALL_NUMBER));
+
+	// Rounding to the nearest step of a normalized 16-bit integer gives a maximum error of half a step
+	const float MaxError = Extent.GetMax() / INT16_MAX * 0.5f;
+	if (MaxError > Builder.ExportOptions->PositionQuantizationTolerance)
+	{
+		return Quantization;
+	}
+
+	const float ExportScale = Builder.ExportOptions->ExportUniformScale;
+
+	Quantization.Translation = FGLTFConverterUtility::ConvertPosition(Bounds.GetCenter(), ExportScale);
+	Quantization.Scale = FGLTFConverterUtility::ConvertScale(Extent * ExportScale);
+	Quantization.bIsValid = true;
+
+	return Quantization;
+}
@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Core/GLTFVector.h"
+#include "Converters/GLTFConverter.h"
+#include "Converters/GLTFBuilderContext.h"
+#include "Engine.h"
+
+struct FGLTFPositionQuantization
+{
+	// Dequantization transform (in glTF space) that maps normalized positions back to their original values
+	FGLTFVector3 Translation;
+	FGLTFVector3 Scale;
+
+	bool bIsValid;
+
+	FGLTFPositionQuantization()
+		: Translation({ 0, 0, 0 })
+		, Scale({ 1, 1, 1 })
+		, bIsValid(false)
+	{
+	}
+
+	FGLTFInt16Vector4 Quantize(const FGLTFVector3& Position) const
+	{
+		FGLTFInt16Vector4 Result;
+
+		for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+		{
+			const float NormalizedValue = (Position.Components[ComponentIndex] - Translation.Components[ComponentIndex]) / Scale.Components[ComponentIndex];
+			Result.Components[ComponentIndex] = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(NormalizedValue * INT16_MAX), -INT16_MAX, INT16_MAX));
+		}
+
+		Result.W = 0; // padding, since vertex attributes must be 4-byte aligned
+		return Result;
+	}
+};
+
+class FGLTFPositionQuantizationConverter final : public FGLTFBuilderContext, public TGLTFConverter<FGLTFPositionQuantization, const FPositionVertexBuffer*>
+{
+	using FGLTFBuilderContext::FGLTFBuilderContext;
+
+	virtual FGLTFPositionQuantization Convert(const FPositionVertexBuffer* VertexBuffer) override;
+};
@@ -4,13 +4,239 @@
 #include "Builders/GLTFContainerBuilder.h"
 #include "Converters/GLTFConverterUtility.h"
 #include "Converters/GLTFActorUtility.h"
+#include "Converters/GLTFInstancingUtility.h"
+#include "Converters/GLTFMeshUtility.h"
+#include "Converters/GLTFTileUtility.h"
+#include "Tasks/GLTFMeshTasks.h"
 #include "LevelVariantSetsActor.h"
+#include "Engine/StaticMeshActor.h"
+#include "Algo/StableSort.h"
+
+namespace
+{
+	bool IsInExportTile(const FGLTFConvertBuilder& Builder, const AActor* Actor)
+	{
+		if (Actor == nullptr)
+		{
+			return false;
+		}
+
+		if (!FGLTFTileUtility::ShouldExportTiles(Builder.ExportOptions))
+		{
+			return true;
+		}
+
+		FIntVector Tile;
+		const bool bHasTile = FGLTFTileUtility::GetTile(Actor, Builder.bSelectedActorsOnly, Builder.ExportOptions->LevelTileSize, Tile);
+		return Builder.ExportTile.IsSet() ? bHasTile && Tile == Builder.ExportTile.GetValue() : !bHasTile;
+	}
+
+	int32 GetActorsPerExportPass(const FGLTFConvertBuilder& Builder)
+	{
+		// A scene triangle budget is distributed over all meshes at once, which requires every mesh to be known before completing any mesh task
+		return Builder.ExportOptions->SceneTriangleBudget > 0 ? 0 : FMath::Max(Builder.ExportOptions->ActorsPerExportPass, 0);
+	}
+
+	uint32 SpreadBits(uint32 Value)
+	{
+		// Spreads the lower 10 bits of the value so that there are two zero bits between each of them
+		Value &= 0x000003FF;
+		Value = (Value | (Value << 16)) & 0x030000FF;
+		Value = (Value | (Value << 8)) & 0x0300F00F;
+		Value = (Value | (Value << 4)) & 0x030C30C3;
+		Value = (Value | (Value << 2)) & 0x09249249;
+		return Value;
+	}
+
+	void SortActorsSpatially(TArray<const AActor*>& Actors, bool bSelectedOnly)
+	{
+		// Actors are sorted along a Z-order curve through the bounds of the level, using the center of the bounds of their root actor
+		// so that attached actors stay together. Actors without bounds (e.g. lights) are visited first.
+		TMap<const AActor*, FVector> RootActorCenters;
+		FBox LevelBounds(ForceInit);
+
+		for (const AActor* Actor : Actors)
+		{
+			const AActor* RootActor = Actor != nullptr ? FGLTFActorUtility::GetRootActor(Actor, bSelectedOnly) : nullptr;
+			if (RootActor == nullptr || RootActorCenters.Contains(RootActor))
+			{
+				continue;
+			}
+
+			const FBox Bounds = RootActor->GetComponentsBoundingBox(true);
+			if (Bounds.IsValid)
+			{
+				const FVector Center = Bounds.GetCenter();
+				RootActorCenters.Add(RootActor, Center);
+				LevelBounds += Center;
+			}
+		}
+
+		const FVector LevelSize = LevelBounds.IsValid ? LevelBounds.GetSize() : FVector::ZeroVector;
+		TMap<const AActor*, uint32> SortKeys;
+
+		for (const AActor* Actor : Actors)
+		{
+			const FVector* Center = Actor != nullptr ? RootActorCenters.Find(FGLTFActorUtility::GetRootActor(Actor, bSelectedOnly)) : nullptr;
+			if (Center == nullptr)
+			{
+				SortKeys.Add(Actor, 0);
+				continue;
+			}
+
+			uint32 Cell[3];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float Alpha = LevelSize[Axis] > 0 ? ((*Center)[Axis] - LevelBounds.Min[Axis]) / LevelSize[Axis] : 0;
+				Cell[Axis] = static_cast<uint32>(FMath::Clamp(FMath::FloorToInt(Alpha * 1024), 0, 1023));
+			}
+
+			SortKeys.Add(Actor, 1 + (SpreadBits(Cell[0]) | (SpreadBits(Cell[1]) << 1) | (SpreadBits(Cell[2]) << 2)));
+		}
+
+		Algo::StableSortBy(Actors, [&SortKeys](const AActor* Actor) { return SortKeys[Actor]; });
+	}
+
+	typedef TTuple<const UStaticMesh*, FGLTFMaterialArray, int32> FGLTFInstanceKey;
+
+	void AddRepeatedMeshInstances(FGLTFConvertBuilder& Builder, const UWorld* World, FGLTFJsonScene& Scene, TSet<const AActor*>& OutInstancedActors)
+	{
+		TMap<FGLTFInstanceKey, TArray<const UStaticMeshComponent*>> InstanceGroups;
+
+		for (int32 Index = 0; Index < World->GetNumLevels(); ++Index)
+		{
+			const ULevel* Level = World->GetLevel(Index);
+			if (Level == nullptr)
+			{
+				continue;
+			}
+
+			for (const AActor* Actor : Level->Actors)
+			{
+				if (!FGLTFInstancingUtility::IsInstanceableActor(Actor, Builder.bSelectedActorsOnly, Builder.ExportOptions->bExportHiddenInGame) || !IsInExportTile(Builder, Actor))
+				{
+					continue;
+				}
+
+				const UStaticMeshComponent* StaticMeshComponent = CastChecked<AStaticMeshActor>(Actor)->GetStaticMeshComponent();
+				const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+				const int32 LODIndex = FGLTFMeshUtility::GetLOD(StaticMesh, StaticMeshComponent, Builder.ExportOptions->DefaultLevelOfDetail);
+
+				const FGLTFInstanceKey Key(StaticMesh, FGLTFMaterialArray(StaticMeshComponent->GetMaterials()), LODIndex);
+				InstanceGroups.FindOrAdd(Key).Add(StaticMeshComponent);
+			}
+		}
+
+		for (const TPair<FGLTFInstanceKey, TArray<const UStaticMeshComponent*>>& InstanceGroup : InstanceGroups)
+		{
+			const TArray<const UStaticMeshComponent*>& StaticMeshComponents = InstanceGroup.Value;
+			if (StaticMeshComponents.Num() < 2)
+			{
+				continue;
+			}
+
+			TArray<FTransform> InstanceTransforms;
+			InstanceTransforms.Reserve(StaticMeshComponents.Num());
+
+			for (const UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
+			{
+				InstanceTransforms.Add(StaticMeshComponent->GetComponentTransform());
+				OutInstancedActors.Add(StaticMeshComponent->GetOwner());
+			}
+
+			// Instances are placed in world space, since only root actors are merged
+			FGLTFJsonNode Node;
+			Node.Name = InstanceGroup.Key.Get<0>()->GetName();
+			Node.Mesh = Builder.GetOrAddMesh(StaticMeshComponents[0], {}, InstanceGroup.Key.Get<2>());
+
+			const FGLTFJsonNodeIndex NodeIndex = Builder.AddNode(Node);
+			FGLTFInstancingUtility::SetNodeInstances(Builder, NodeIndex, InstanceTransforms);
+			Scene.Nodes.Add(NodeIndex);
+		}
+	}
+
+	void AddStaticMeshBatches(FGLTFConvertBuilder& Builder, const UWorld* World, FGLTFJsonScene& Scene, TSet<const AActor*>& InOutExcludedActors)
+	{
+		// Actors are clustered by the grid cell containing the center of their bounds, so that viewers can still cull each batch
+		const float ClusterSize = Builder.ExportOptions->StaticMeshBatchClusterSize;
+		TMap<FIntVector, TArray<const UStaticMeshComponent*>> Clusters;
+
+		for (int32 Index = 0; Index < World->GetNumLevels(); ++Index)
+		{
+			const ULevel* Level = World->GetLevel(Index);
+			if (Level == nullptr)
+			{
+				continue;
+			}
+
+			for (const AActor* Actor : Level->Actors)
+			{
+				if (InOutExcludedActors.Contains(Actor) || !FGLTFInstancingUtility::IsInstanceableActor(Actor, Builder.bSelectedActorsOnly, Builder.ExportOptions->bExportHiddenInGame) ||
+					!IsInExportTile(Builder, Actor))
+				{
+					continue;
+				}
+
+				const UStaticMeshComponent* StaticMeshComponent = CastChecked<AStaticMeshActor>(Actor)->GetStaticMeshComponent();
+				const FVector Center = StaticMeshComponent->Bounds.Origin;
+
+				const FIntVector Cell = ClusterSize > 0
+					? FIntVector(FMath::FloorToInt(Center.X / ClusterSize), FMath::FloorToInt(Center.Y / ClusterSize), FMath::FloorToInt(Center.Z / ClusterSize))
+					: FIntVector::ZeroValue;
+
+				Clusters.FindOrAdd(Cell).Add(StaticMeshComponent);
+			}
+		}
+
+		for (const TPair<FIntVector, TArray<const UStaticMeshComponent*>>& Cluster : Clusters)
+		{
+			const TArray<const UStaticMeshComponent*>& StaticMeshComponents = Cluster.Value;
+			if (StaticMeshComponents.Num() < 2)
+			{
+				continue;
+			}
+
+			for (const UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
+			{
+				InOutExcludedActors.Add(StaticMeshComponent->GetOwner());
+			}
+
+			// Batched vertices are transformed to world space, since only root actors are merged
+			FGLTFJsonMesh JsonMesh;
+			JsonMesh.Name = FString::Printf(TEXT("StaticMeshBatch_%d_%d_%d"), Cluster.Key.X, Cluster.Key.Y, Cluster.Key.Z);
+
+			FGLTFJsonNode Node;
+			Node.Name = JsonMesh.Name;
+			Node.Mesh = Builder.AddMesh(JsonMesh);
+
+			Builder.SetupTask<FGLTFStaticMeshBatchTask>(Builder, StaticMeshComponents, Node.Mesh);
+			Scene.Nodes.Add(Builder.AddNode(Node));
+		}
+	}
+}
 
 FGLTFJsonSceneIndex FGLTFSceneConverter::Convert(const UWorld* World)
 {
 	FGLTFJsonScene Scene;
 	World->GetName(Scene.Name);
 
+	TSet<const AActor*> MergedActors;
+
+	// Lightmaps and variants are specific to each actor, and can therefore not be shared by instances
+	if (Builder.ExportOptions->bExportMeshInstances && Builder.ExportOptions->bInstanceRepeatedMeshes &&
+		!Builder.ExportOptions->bExportLightmaps && !Builder.ExportOptions->bExportVariantSets)
+	{
+		AddRepeatedMeshInstances(Builder, World, Scene, MergedActors);
+	}
+
+	// Static mesh actors that were not instanced above can still be merged into batches, for the same reasons only when not exporting lightmaps or variants
+	if (Builder.ExportOptions->bBatchStaticMeshes && !Builder.ExportOptions->bExportLightmaps && !Builder.ExportOptions->bExportVariantSets)
+	{
+		AddStaticMeshBatches(Builder, World, Scene, MergedActors);
+	}
+
+	TArray<const AActor*> Actors;
+
 	for (int32 Index = 0; Index < World->GetNumLevels(); ++Index)
 	{
 		ULevel* Level = World->GetLevel(Index);
@@ -33,29 +259,55 @@ FGLTFJsonSceneIndex FGLTFSceneConverter::Convert(const UWorld* World)
 				continue; // TODO: can we safely assume no other actor is ever attached to the default physics volume?
 			}
 
-			// TODO: should a LevelVariantSet be exported even if not selected for export?
-			if (const ALevelVariantSetsActor *LevelVariantSetsActor = Cast<ALevelVariantSetsActor>(Actor))
+			if (Actor == nullptr || MergedActors.Contains(Actor) || !IsInExportTile(Builder, Actor))
+			{
+				continue;
+			}
+
+			Actors.Add(Actor);
+		}
+	}
+
+	const int32 ActorsPerPass = GetActorsPerExportPass(Builder);
+	if (ActorsPerPass > 0)
+	{
+		// Instanced and batched actors above are completed as a pass of their own
+		SortActorsSpatially(Actors, Builder.bSelectedActorsOnly);
+		Builder.CompleteAllTasks();
+	}
+
+	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+	{
+		const AActor* Actor = Actors[ActorIndex];
+
+		// TODO: should a LevelVariantSet be exported even if not selected for export?
+		if (const ALevelVariantSetsActor *LevelVariantSetsActor = Cast<ALevelVariantSetsActor>(Actor))
+		{
+			if (Builder.ExportOptions->bExportVariantSets)
 			{
-				if (Builder.ExportOptions->bExportVariantSets)
+				if (const ULevelVariantSets* LevelVariantSets = const_cast<ALevelVariantSetsActor*>(LevelVariantSetsActor)->GetLevelVariantSets(true))
 				{
-					if (const ULevelVariantSets* LevelVariantSets = const_cast<ALevelVariantSetsActor*>(LevelVariantSetsActor)->GetLevelVariantSets(true))
+					const FGLTFJsonLevelVariantSetsIndex LevelVariantSetsIndex = Builder.GetOrAddLevelVariantSets(LevelVariantSets);
+					if (LevelVariantSetsIndex != INDEX_NONE)
 					{
-						const FGLTFJsonLevelVariantSetsIndex LevelVariantSetsIndex = Builder.GetOrAddLevelVariantSets(LevelVariantSets);
-						if (LevelVariantSetsIndex != INDEX_NONE)
-						{
-							Scene.LevelVariantSets.Add(LevelVariantSetsIndex);
-						}
+						Scene.LevelVariantSets.Add(LevelVariantSetsIndex);
 					}
 				}
 			}
+		}
 
-			const FGLTFJsonNodeIndex NodeIndex = Builder.GetOrAddNode(Actor);
-			if (NodeIndex != INDEX_NONE && FGLTFActorUtility::IsRootActor(Actor, Builder.bSelectedActorsOnly))
-			{
-				// TODO: to avoid having to add irrelevant actors/components let GLTFComponentConverter decide and add root nodes to scene.
-				// This change may require node converters to support cyclic calls.
-				Scene.Nodes.Add(NodeIndex);
-			}
+		const FGLTFJsonNodeIndex NodeIndex = Builder.GetOrAddNode(Actor);
+		if (NodeIndex != INDEX_NONE && FGLTFActorUtility::IsRootActor(Actor, Builder.bSelectedActorsOnly))
+		{
+			// TODO: to avoid having to add irrelevant actors/components let GLTFComponentConverter decide and add root nodes to scene.
+			// This change may require node converters to support cyclic calls.
+			Scene.Nodes.Add(NodeIndex);
+		}
+
+		// Completing all pending tasks (meshes, materials, textures etc) releases their intermediate data, leaving only what later passes may reuse
+		if (ActorsPerPass > 0 && (ActorIndex + 1) % ActorsPerPass == 0)
+		{
+			Builder.CompleteAllTasks();
 		}
 	}
 
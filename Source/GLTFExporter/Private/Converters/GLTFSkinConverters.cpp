@@ -5,39 +5,137 @@
 #include "Converters/GLTFBoneUtility.h"
 #include "Builders/GLTFConvertBuilder.h"
 
-FGLTFJsonSkinIndex FGLTFSkinConverter::Convert(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh)
+const FGLTFSkinJoints* FGLTFSkinJointsConverter::Convert(const USkeletalMesh* SkeletalMesh)
+{
+	FGLTFSkinJoints* SkinJoints = Outputs.Add_GetRef(MakeUnique<FGLTFSkinJoints>()).Get();
+
+	const TArray<FMeshBoneInfo>& BoneInfos = SkeletalMesh->RefSkeleton.GetRefBoneInfo();
+	const int32 BoneCount = BoneInfos.Num();
+
+	TBitArray<> UsedBones(!Builder.ExportOptions->bStripUnusedBones, BoneCount);
+
+	if (Builder.ExportOptions->bStripUnusedBones)
+	{
+		// Keep every bone that skins a vertex in any LOD, since any LOD may be exported
+		if (const FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering())
+		{
+			for (const FSkeletalMeshLODRenderData& MeshLOD : RenderData->LODRenderData)
+			{
+				for (const FSkelMeshRenderSection& RenderSection : MeshLOD.RenderSections)
+				{
+					for (const FBoneIndexType BoneIndex : RenderSection.BoneMap)
+					{
+						UsedBones[BoneIndex] = true;
+					}
+				}
+			}
+		}
+
+		// Keep every bone that a socket (of either the mesh or its skeleton) is attached to
+		const int32 SocketCount = SkeletalMesh->NumSockets();
+		for (int32 SocketIndex = 0; SocketIndex < SocketCount; ++SocketIndex)
+		{
+			const int32 BoneIndex = SkeletalMesh->RefSkeleton.FindBoneIndex(SkeletalMesh->GetSocketByIndex(SocketIndex)->BoneName);
+			if (BoneIndex != INDEX_NONE)
+			{
+				UsedBones[BoneIndex] = true;
+			}
+		}
+
+		// Keep all ancestors of the used bones so that the hierarchy is unchanged. Parents always precede their children,
+		// so a single reverse pass is enough.
+		for (int32 BoneIndex = BoneCount - 1; BoneIndex > 0; --BoneIndex)
+		{
+			const int32 ParentIndex = BoneInfos[BoneIndex].ParentIndex;
+			if (UsedBones[BoneIndex] && ParentIndex != INDEX_NONE)
+			{
+				UsedBones[ParentIndex] = true;
+			}
+		}
+	}
+
+	SkinJoints->JointIndices.Init(INDEX_NONE, BoneCount);
+
+	for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+	{
+		if (UsedBones[BoneIndex])
+		{
+			SkinJoints->JointIndices[BoneIndex] = SkinJoints->Bones.Add(BoneIndex);
+		}
+	}
+
+	return SkinJoints;
+}
+
+void FGLTFSkinConverter::Sanitize(FGLTFJsonNodeIndex& RootNode, const USkeletalMesh*& SkeletalMesh, const FGLTFSkinJoints*& SkinJoints, const USkeletalMesh*& RootMesh)
+{
+	if (SkinJoints == nullptr)
+	{
+		SkinJoints = Builder.GetOrAddSkinJoints(SkeletalMesh);
+	}
+
+	if (RootMesh == nullptr)
+	{
+		RootMesh = SkeletalMesh;
+	}
+
+	if (RootMesh != SkeletalMesh && SkinJoints == Builder.GetOrAddSkinJoints(SkeletalMesh))
+	{
+		// Meshes with identical bones (and joints) have identical skins, so the skin of the root mesh can be shared
+		const FGLTFSkinJoints* RootSkinJoints = Builder.GetOrAddSkinJoints(RootMesh);
+		if (RootSkinJoints->Bones == SkinJoints->Bones && FGLTFBoneUtility::IsSameSkeleton(RootMesh->RefSkeleton, SkeletalMesh->RefSkeleton))
+		{
+			SkeletalMesh = RootMesh;
+			SkinJoints = RootSkinJoints;
+		}
+	}
+}
+
+FGLTFJsonSkinIndex FGLTFSkinConverter::Convert(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, const FGLTFSkinJoints* SkinJoints, const USkeletalMesh* RootMesh)
 {
 	FGLTFJsonSkin Skin;
 	Skin.Name = SkeletalMesh->Skeleton != nullptr ? SkeletalMesh->Skeleton->GetName() : SkeletalMesh->GetName();
 	Skin.Skeleton = RootNode;
 
-	const int32 BoneCount = SkeletalMesh->RefSkeleton.GetNum();
-	if (BoneCount == 0)
+	const TArray<int32>& JointBones = SkinJoints->Bones;
+	const int32 JointCount = JointBones.Num();
+	if (JointCount == 0)
 	{
 		// TODO: report warning
 		return FGLTFJsonSkinIndex(INDEX_NONE);
 	}
 
-	Skin.Joints.AddUninitialized(BoneCount);
+	Skin.Joints.AddUninitialized(JointCount);
 
-	for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+	for (int32 JointIndex = 0; JointIndex < JointCount; ++JointIndex)
 	{
-		Skin.Joints[BoneIndex] = Builder.GetOrAddNode(RootNode, SkeletalMesh, BoneIndex);
+		const int32 BoneIndex = JointBones[JointIndex];
+		const int32 RootBoneIndex = RootMesh != SkeletalMesh ? RootMesh->RefSkeleton.FindBoneIndex(SkeletalMesh->RefSkeleton.GetBoneName(BoneIndex)) : BoneIndex;
+
+		// Bones missing from the root mesh aren't driven by its pose, so they get nodes of their own (just like without a leader pose)
+		Skin.Joints[JointIndex] = RootBoneIndex != INDEX_NONE
+			? Builder.GetOrAddNode(RootNode, RootMesh, RootBoneIndex)
+			: Builder.GetOrAddNode(RootNode, SkeletalMesh, BoneIndex);
 	}
 
-	TArray<FGLTFMatrix4> InverseBindMatrices;
-	InverseBindMatrices.AddUninitialized(BoneCount);
+	const TArray<FTransform> BindTransforms = FGLTFBoneUtility::GetBindTransforms(SkeletalMesh->RefSkeleton);
 
-	for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+	TArray<FTransform> InverseBindTransforms;
+	InverseBindTransforms.AddUninitialized(JointCount);
+
+	for (int32 JointIndex = 0; JointIndex < JointCount; ++JointIndex)
 	{
-		const FTransform InverseBindTransform = FGLTFBoneUtility::GetBindTransform(SkeletalMesh->RefSkeleton, BoneIndex).Inverse();
-		InverseBindMatrices[BoneIndex] = FGLTFConverterUtility::ConvertTransform(InverseBindTransform, Builder.ExportOptions->ExportUniformScale);
+		InverseBindTransforms[JointIndex] = BindTransforms[JointBones[JointIndex]].Inverse();
 	}
 
+	TArray<FGLTFMatrix4> InverseBindMatrices;
+	InverseBindMatrices.AddUninitialized(JointCount);
+	FGLTFConverterUtility::ConvertTransforms(InverseBindTransforms, Builder.ExportOptions->ExportUniformScale, InverseBindMatrices);
+
 	FGLTFJsonAccessor JsonAccessor;
 	JsonAccessor.BufferView = Builder.AddBufferView(InverseBindMatrices);
 	JsonAccessor.ComponentType = EGLTFJsonComponentType::F32;
-	JsonAccessor.Count = BoneCount;
+	JsonAccessor.Count = JointCount;
 	JsonAccessor.Type = EGLTFJsonAccessorType::Mat4;
 
 	Skin.InverseBindMatrices = Builder.AddAccessor(JsonAccessor);
@@ -7,9 +7,31 @@
 #include "Converters/GLTFBuilderContext.h"
 #include "Engine.h"
 
-class FGLTFSkinConverter final : public FGLTFBuilderContext, public TGLTFConverter<FGLTFJsonSkinIndex, FGLTFJsonNodeIndex, const USkeletalMesh*>
+struct FGLTFSkinJoints
+{
+	// Bones of the skeletal mesh that are exported as joints, in ascending order
+	TArray<int32> Bones;
+
+	// Joint index of each bone of the skeletal mesh, or INDEX_NONE if the bone has been stripped
+	TArray<int32> JointIndices;
+};
+
+class FGLTFSkinJointsConverter final : public FGLTFBuilderContext, public TGLTFConverter<const FGLTFSkinJoints*, const USkeletalMesh*>
 {
 	using FGLTFBuilderContext::FGLTFBuilderContext;
 
-	virtual FGLTFJsonSkinIndex Convert(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh) override;
+	TArray<TUniquePtr<FGLTFSkinJoints>> Outputs;
+
+	virtual const FGLTFSkinJoints* Convert(const USkeletalMesh* SkeletalMesh) override;
+};
+
+// Joints are the bone nodes of RootMesh (under RootNode), where RootMesh is either the skeletal mesh itself or the mesh of a leader pose component.
+// In the latter case bones are matched by name, and the skin of the leader is reused if both meshes have identical bones.
+class FGLTFSkinConverter final : public FGLTFBuilderContext, public TGLTFConverter<FGLTFJsonSkinIndex, FGLTFJsonNodeIndex, const USkeletalMesh*, const FGLTFSkinJoints*, const USkeletalMesh*>
+{
+	using FGLTFBuilderContext::FGLTFBuilderContext;
+
+	virtual void Sanitize(FGLTFJsonNodeIndex& RootNode, const USkeletalMesh*& SkeletalMesh, const FGLTFSkinJoints*& SkinJoints, const USkeletalMesh*& RootMesh) override;
+
+	virtual FGLTFJsonSkinIndex Convert(FGLTFJsonNodeIndex RootNode, const USkeletalMesh* SkeletalMesh, const FGLTFSkinJoints* SkinJoints, const USkeletalMesh* RootMesh) override;
 };
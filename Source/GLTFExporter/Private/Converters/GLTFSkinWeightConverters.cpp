@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFSkinWeightConverters.h"
+#include "Converters/GLTFSkinWeightVertexBufferHack.h"
+#include "Builders/GLTFConvertBuilder.h"
+
+namespace
+{
+	void LimitBoneInfluences(uint32* BoneIndices, uint8* BoneWeights, uint32 InfluenceCount, uint32 MaxInfluenceCount)
+	{
+		// Insertion sort by descending weight, since there are only a handful of influences per vertex
+		for (uint32 Index = 1; Index < InfluenceCount; ++Index)
+		{
+			const uint32 BoneIndex = BoneIndices[Index];
+			const uint8 BoneWeight = BoneWeights[Index];
+
+			uint32 InsertIndex = Index;
+			for (; InsertIndex > 0 && BoneWeights[InsertIndex - 1] < BoneWeight; --InsertIndex)
+			{
+				BoneIndices[InsertIndex] = BoneIndices[InsertIndex - 1];
+				BoneWeights[InsertIndex] = BoneWeights[InsertIndex - 1];
+			}
+
+			BoneIndices[InsertIndex] = BoneIndex;
+			BoneWeights[InsertIndex] = BoneWeight;
+		}
+
+		uint32 WeightSum = 0;
+		for (uint32 Index = 0; Index < MaxInfluenceCount; ++Index)
+		{
+			WeightSum += BoneWeights[Index];
+		}
+
+		if (WeightSum == 0 || WeightSum == UINT8_MAX)
+		{
+			return;
+		}
+
+		// Renormalize the kept weights, and add any rounding error to the largest weight so that they still sum to one
+		uint32 NormalizedSum = 0;
+		for (uint32 Index = 0; Index < MaxInfluenceCount; ++Index)
+		{
+			BoneWeights[Index] = static_cast<uint8>(BoneWeights[Index] * UINT8_MAX / WeightSum);
+			NormalizedSum += BoneWeights[Index];
+		}
+
+		BoneWeights[0] += static_cast<uint8>(UINT8_MAX - NormalizedSum);
+	}
+}
+
+void FGLTFSkinWeightsConverter::ReleaseOutputs()
+{
+	for (const TUniquePtr<FGLTFSkinWeights>& Output : Outputs)
+	{
+		Output->Joints.Empty();
+		Output->Weights.Empty();
+	}
+
+	ClearSavedOutputs();
+}
+
+const FGLTFSkinWeights* FGLTFSkinWeightsConverter::Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer)
+{
+	FGLTFSkinWeights* SkinWeights = Outputs.Add_GetRef(MakeUnique<FGLTFSkinWeights>()).Get();
+
+	const uint32 MaxBoneInfluences = VertexBuffer->GetMaxBoneInfluences();
+	if (MaxBoneInfluences == 0 || VertexBuffer->GetNumVertices() == 0)
+	{
+		return SkinWeights;
+	}
+
+	const int32 MaximumBoneInfluences = Builder.ExportOptions->MaximumBoneInfluences;
+	const uint32 MaxInfluenceCount = MaximumBoneInfluences > 0 ? FMath::Min<uint32>(MaxBoneInfluences, MaximumBoneInfluences) : MaxBoneInfluences;
+	const bool bLimitInfluences = MaxInfluenceCount < MaxBoneInfluences;
+
+	// Joints and weights are written in sets of four
+	const uint32 InfluenceCount = Align(MaxInfluenceCount, 4);
+
+	const TArray<uint32>& IndexMap = MeshSection->IndexMap;
+	const uint32 VertexCount = IndexMap.Num();
+
+	SkinWeights->InfluenceCount = InfluenceCount;
+	SkinWeights->Joints.AddZeroed(VertexCount * InfluenceCount);
+	SkinWeights->Weights.AddZeroed(VertexCount * InfluenceCount);
+
+	// TODO: remove hack
+	const FGLTFSkinWeightVertexBufferHack SkinWeightBuffer(VertexBuffer);
+
+	TArray<uint32> BoneIndices;
+	TArray<uint8> BoneWeights;
+	BoneIndices.AddUninitialized(MaxBoneInfluences);
+	BoneWeights.AddUninitialized(MaxBoneInfluences);
+
+	for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+	{
+		const uint32 VertexInfluenceCount = SkinWeightBuffer.GetBoneInfluences(IndexMap[VertexIndex], BoneIndices.GetData(), BoneWeights.GetData());
+
+		if (bLimitInfluences && VertexInfluenceCount > MaxInfluenceCount)
+		{
+			LimitBoneInfluences(BoneIndices.GetData(), BoneWeights.GetData(), VertexInfluenceCount, MaxInfluenceCount);
+		}
+
+		const TArray<FBoneIndexType>& BoneMap = MeshSection->BoneMaps[MeshSection->BoneMapLookup[VertexIndex]];
+		const uint32 Offset = VertexIndex * InfluenceCount;
+		const uint32 CopyCount = FMath::Min(VertexInfluenceCount, MaxInfluenceCount);
+
+		for (uint32 InfluenceIndex = 0; InfluenceIndex < CopyCount; ++InfluenceIndex)
+		{
+			SkinWeights->Joints[Offset + InfluenceIndex] = BoneMap[BoneIndices[InfluenceIndex]];
+			SkinWeights->Weights[Offset + InfluenceIndex] = BoneWeights[InfluenceIndex];
+		}
+	}
+
+	return SkinWeights;
+}
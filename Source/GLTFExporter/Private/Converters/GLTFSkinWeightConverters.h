@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Converters/GLTFConverter.h"
+#include "Converters/GLTFBuilderContext.h"
+#include "Converters/GLTFMeshSection.h"
+#include "Engine.h"
+
+struct FGLTFSkinWeights
+{
+	// Influences of each vertex (in the order of the mesh section), stored as InfluenceCount consecutive joints and weights.
+	// Joints are mapped to bone indices of the skeleton, and unused influences are left with zero weight.
+	uint32 InfluenceCount;
+	TArray<FBoneIndexType> Joints;
+	TArray<uint8> Weights;
+
+	FGLTFSkinWeights()
+		: InfluenceCount(0)
+	{
+	}
+};
+
+class FGLTFSkinWeightsConverter final : public FGLTFBuilderContext, public TGLTFConverter<const FGLTFSkinWeights*, const FGLTFMeshSection*, const FSkinWeightVertexBuffer*>
+{
+	using FGLTFBuilderContext::FGLTFBuilderContext;
+
+public:
+
+	void ReleaseOutputs();
+
+private:
+
+	TArray<TUniquePtr<FGLTFSkinWeights>> Outputs;
+
+	virtual const FGLTFSkinWeights* Convert(const FGLTFMeshSection* MeshSection, const FSkinWeightVertexBuffer* VertexBuffer) override;
+};
@@ -43,6 +43,30 @@ public:
 		return 0;
 	}
 
+	void GetBoneInfluences(uint32 VertexWeightOffset, uint32 VertexInfluenceCount, uint32* OutBoneIndices, uint8* OutBoneWeights) const
+	{
+		const uint8* BoneData = Data + VertexWeightOffset;
+		const uint32 BoneWeightOffset = GetBoneIndexByteSize() * VertexInfluenceCount;
+
+		if (Use16BitBoneIndex())
+		{
+			const FBoneIndex16* BoneIndex16Ptr = (const FBoneIndex16*)BoneData;
+			for (uint32 InfluenceIndex = 0; InfluenceIndex < VertexInfluenceCount; ++InfluenceIndex)
+			{
+				OutBoneIndices[InfluenceIndex] = BoneIndex16Ptr[InfluenceIndex];
+			}
+		}
+		else
+		{
+			for (uint32 InfluenceIndex = 0; InfluenceIndex < VertexInfluenceCount; ++InfluenceIndex)
+			{
+				OutBoneIndices[InfluenceIndex] = BoneData[InfluenceIndex];
+			}
+		}
+
+		FMemory::Memcpy(OutBoneWeights, BoneData + BoneWeightOffset, VertexInfluenceCount);
+	}
+
 	// guaranteed only to be valid if the vertex buffer is valid
 	FShaderResourceViewRHIRef SRVValue;
 
@@ -143,6 +167,16 @@ public:
 		return DataVertexBuffer.GetBoneWeight(VertexWeightOffset, VertexInfluenceCount, InfluenceIndex);
 	}
 
+	// Reads all influences of a vertex with a single lookup, and returns how many were read (at most GetMaxBoneInfluences)
+	uint32 GetBoneInfluences(uint32 VertexIndex, uint32* OutBoneIndices, uint8* OutBoneWeights) const
+	{
+		uint32 VertexWeightOffset = 0;
+		uint32 VertexInfluenceCount = 0;
+		GetVertexInfluenceOffsetCount(VertexIndex, VertexWeightOffset, VertexInfluenceCount);
+		DataVertexBuffer.GetBoneInfluences(VertexWeightOffset, VertexInfluenceCount, OutBoneIndices, OutBoneWeights);
+		return VertexInfluenceCount;
+	}
+
 private:
 
 	const FSkinWeightVertexBuffer& VertexBuffer;
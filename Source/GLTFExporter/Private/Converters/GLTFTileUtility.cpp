@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFTileUtility.h"
+#include "Converters/GLTFActorUtility.h"
+#include "GLTFExportOptions.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+	void AddActorBounds(const AActor* Actor, bool bSelectedOnly, FBox& OutBounds)
+	{
+		OutBounds += Actor->GetComponentsBoundingBox(true);
+
+		TArray<AActor*> AttachedActors;
+		Actor->GetAttachedActors(AttachedActors);
+
+		for (const AActor* AttachedActor : AttachedActors)
+		{
+			if (AttachedActor != nullptr && (!bSelectedOnly || AttachedActor->IsSelected()))
+			{
+				AddActorBounds(AttachedActor, bSelectedOnly, OutBounds);
+			}
+		}
+	}
+
+	// NOTE: attached actors are included, so that e.g. an empty actor grouping meshes is tiled with them rather than left in the main file
+	bool GetRootActorBounds(const AActor* RootActor, bool bSelectedOnly, FBox& OutBounds)
+	{
+		OutBounds = FBox(ForceInit);
+		AddActorBounds(RootActor, bSelectedOnly, OutBounds);
+		return OutBounds.IsValid != 0;
+	}
+
+	FIntVector GetTileForBounds(const FBox& Bounds, float TileSize)
+	{
+		const FVector Center = Bounds.GetCenter();
+		return FIntVector(FMath::FloorToInt(Center.X / TileSize), FMath::FloorToInt(Center.Y / TileSize), FMath::FloorToInt(Center.Z / TileSize));
+	}
+}
+
+bool FGLTFTileUtility::ShouldExportTiles(const UGLTFExportOptions* ExportOptions)
+{
+	// Variants may reference actors in any tile, and can therefore not be split across files
+	return ExportOptions->bExportLevelTiles && ExportOptions->LevelTileSize > 0 && !ExportOptions->bExportVariantSets;
+}
+
+bool FGLTFTileUtility::GetTile(const AActor* Actor, bool bSelectedOnly, float TileSize, FIntVector& OutTile)
+{
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+
+	FBox Bounds;
+	if (!GetRootActorBounds(FGLTFActorUtility::GetRootActor(Actor, bSelectedOnly), bSelectedOnly, Bounds))
+	{
+		return false;
+	}
+
+	OutTile = GetTileForBounds(Bounds, TileSize);
+	return true;
+}
+
+void FGLTFTileUtility::GetTileBounds(const UWorld* World, bool bSelectedOnly, float TileSize, TMap<FIntVector, FBox>& OutTileBounds)
+{
+	for (int32 Index = 0; Index < World->GetNumLevels(); ++Index)
+	{
+		const ULevel* Level = World->GetLevel(Index);
+		if (Level == nullptr)
+		{
+			continue;
+		}
+
+		for (const AActor* Actor : Level->Actors)
+		{
+			if (Actor == nullptr || (bSelectedOnly && !Actor->IsSelected()) || !FGLTFActorUtility::IsRootActor(Actor, bSelectedOnly))
+			{
+				continue;
+			}
+
+			FBox Bounds;
+			if (!GetRootActorBounds(Actor, bSelectedOnly, Bounds))
+			{
+				continue;
+			}
+
+			const FIntVector Tile = GetTileForBounds(Bounds, TileSize);
+			if (FBox* TileBounds = OutTileBounds.Find(Tile))
+			{
+				*TileBounds += Bounds;
+			}
+			else
+			{
+				OutTileBounds.Add(Tile, Bounds);
+			}
+		}
+	}
+}
+
+FString FGLTFTileUtility::GetTileFilePath(const FString& FilePath, const FIntVector& Tile)
+{
+	const FString Filename = FString::Printf(TEXT("%s_%d_%d_%d.%s"), *FPaths::GetBaseFilename(FilePath), Tile.X, Tile.Y, Tile.Z, *FPaths::GetExtension(FilePath));
+	return FPaths::Combine(FPaths::GetPath(FilePath), Filename);
+}
@@ -0,0 +1,19 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UGLTFExportOptions;
+
+struct FGLTFTileUtility
+{
+	static bool ShouldExportTiles(const UGLTFExportOptions* ExportOptions);
+
+	// Returns the tile (i.e. grid cell) containing the center of the combined bounds of the actor's root actor and its attached actors, or false if none of them have bounds
+	static bool GetTile(const AActor* Actor, bool bSelectedOnly, float TileSize, FIntVector& OutTile);
+
+	static void GetTileBounds(const UWorld* World, bool bSelectedOnly, float TileSize, TMap<FIntVector, FBox>& OutTileBounds);
+
+	static FString GetTileFilePath(const FString& FilePath, const FIntVector& Tile);
+};
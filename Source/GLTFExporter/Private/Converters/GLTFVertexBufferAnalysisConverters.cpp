@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Converters/GLTFVertexBufferAnalysisConverters.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// Vertices are scanned in batches on multiple threads, and the results of each batch combined afterwards
+	const uint32 VertexBatchSize = 16 * 1024;
+
+	template <typename BatchFunctionType>
+	void ParallelForVertexBatches(uint32 VertexCount, BatchFunctionType BatchFunction)
+	{
+		const int32 BatchCount = FMath::DivideAndRoundUp(VertexCount, VertexBatchSize);
+
+		ParallelFor(BatchCount, [VertexCount, &BatchFunction](int32 BatchIndex)
+		{
+			const uint32 FirstVertex = BatchIndex * VertexBatchSize;
+			const uint32 LastVertex = FMath::Min(FirstVertex + VertexBatchSize, VertexCount);
+			BatchFunction(BatchIndex, FirstVertex, LastVertex);
+		}, BatchCount == 1);
+	}
+}
+
+FGLTFTangentBufferAnalysis FGLTFTangentBufferAnalysisConverter::Convert(const FStaticMeshVertexBuffer* VertexBuffer)
+{
+	if (VertexBuffer == nullptr)
+	{
+		return {};
+	}
+
+	return VertexBuffer->GetUseHighPrecisionTangentBasis()
+		? Analyze<FPackedRGBA16N>(VertexBuffer)
+		: Analyze<FPackedNormal>(VertexBuffer);
+}
+
+template <typename TangentVectorType>
+FGLTFTangentBufferAnalysis FGLTFTangentBufferAnalysisConverter::Analyze(const FStaticMeshVertexBuffer* VertexBuffer)
+{
+	typedef TStaticMeshVertexTangentDatum<TangentVectorType> VertexTangentType;
+
+	const void* TangentData = const_cast<FStaticMeshVertexBuffer*>(VertexBuffer)->GetTangentData();
+	if (TangentData == nullptr)
+	{
+		return {};
+	}
+
+	const VertexTangentType* VertexTangents = static_cast<const VertexTangentType*>(TangentData);
+	const uint32 VertexCount = VertexBuffer->GetNumVertices();
+
+	TArray<FGLTFTangentBufferAnalysis> BatchAnalyses;
+	BatchAnalyses.AddDefaulted(FMath::DivideAndRoundUp(VertexCount, VertexBatchSize));
+
+	ParallelForVertexBatches(VertexCount, [VertexTangents, &BatchAnalyses](int32 BatchIndex, uint32 FirstVertex, uint32 LastVertex)
+	{
+		// Accumulate without branching, since the flags are rarely set and the loop is then free to be vectorized
+		bool bZeroNormals = false;
+		bool bZeroTangents = false;
+
+		for (uint32 VertexIndex = FirstVertex; VertexIndex < LastVertex; ++VertexIndex)
+		{
+			const VertexTangentType& VertexTangent = VertexTangents[VertexIndex];
+			bZeroNormals |= VertexTangent.TangentZ.ToFVector().IsNearlyZero();
+			bZeroTangents |= VertexTangent.TangentX.ToFVector().IsNearlyZero();
+		}
+
+		BatchAnalyses[BatchIndex].bHasZeroNormals = bZeroNormals;
+		BatchAnalyses[BatchIndex].bHasZeroTangents = bZeroTangents;
+	});
+
+	FGLTFTangentBufferAnalysis Analysis;
+
+	for (const FGLTFTangentBufferAnalysis& BatchAnalysis : BatchAnalyses)
+	{
+		Analysis.bHasZeroNormals |= BatchAnalysis.bHasZeroNormals;
+		Analysis.bHasZeroTangents |= BatchAnalysis.bHasZeroTangents;
+	}
+
+	return Analysis;
+}
+
+bool FGLTFColorBufferAnalysisConverter::Convert(const FColorVertexBuffer* VertexBuffer)
+{
+	if (VertexBuffer == nullptr)
+	{
+		return false;
+	}
+
+	const uint32 VertexCount = VertexBuffer->GetNumVertices();
+
+	TArray<bool> BatchResults;
+	BatchResults.AddZeroed(FMath::DivideAndRoundUp(VertexCount, VertexBatchSize));
+
+	ParallelForVertexBatches(VertexCount, [VertexBuffer, &BatchResults](int32 BatchIndex, uint32 FirstVertex, uint32 LastVertex)
+	{
+		const uint32 White = FColor::White.DWColor();
+		bool bNonWhiteColors = false;
+
+		for (uint32 VertexIndex = FirstVertex; VertexIndex < LastVertex; ++VertexIndex)
+		{
+			bNonWhiteColors |= VertexBuffer->VertexColor(VertexIndex).DWColor() != White;
+		}
+
+		BatchResults[BatchIndex] = bNonWhiteColors;
+	});
+
+	return BatchResults.Contains(true);
+}
@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Converters/GLTFConverter.h"
+#include "Engine.h"
+
+struct FGLTFTangentBufferAnalysis
+{
+	bool bHasZeroNormals;
+	bool bHasZeroTangents;
+
+	FGLTFTangentBufferAnalysis()
+		: bHasZeroNormals(false)
+		, bHasZeroTangents(false)
+	{
+	}
+};
+
+// Scans the tangent basis of a vertex buffer once, no matter how many meshes (or components) are exported using it
+// NOTE: results are only kept for one export, since a buffer address can be reused by a different buffer once a mesh is rebuilt or garbage collected
+class FGLTFTangentBufferAnalysisConverter final : public TGLTFConverter<FGLTFTangentBufferAnalysis, const FStaticMeshVertexBuffer*>
+{
+	virtual FGLTFTangentBufferAnalysis Convert(const FStaticMeshVertexBuffer* VertexBuffer) override;
+
+	template <typename TangentVectorType>
+	static FGLTFTangentBufferAnalysis Analyze(const FStaticMeshVertexBuffer* VertexBuffer);
+};
+
+// Returns true if any vertex color of a buffer is non-white, scanning each buffer only once
+class FGLTFColorBufferAnalysisConverter final : public TGLTFConverter<bool, const FColorVertexBuffer*>
+{
+	virtual bool Convert(const FColorVertexBuffer* VertexBuffer) override;
+};
@@ -64,5 +64,8 @@ typedef TGLTFVector2<float> FGLTFVector2;
 typedef TGLTFVector3<float> FGLTFVector3;
 typedef TGLTFVector4<float> FGLTFVector4;
 
+typedef TGLTFVector2<int16> FGLTFInt16Vector2;
+typedef TGLTFVector2<uint16> FGLTFUInt16Vector2;
+
 typedef TGLTFVector4<int8> FGLTFInt8Vector4;
 typedef TGLTFVector4<int16> FGLTFInt16Vector4;
@@ -48,6 +48,38 @@ const USkeletalMesh* FGLTFExporterUtility::GetPreviewMesh(const UAnimSequence* A
 	return PreviewMesh;
 }
 
+TArray<UAnimSequence*> FGLTFExporterUtility::GetAnimSequences(const USkeleton* Skeleton)
+{
+	TArray<UAnimSequence*> AnimSequences;
+	if (Skeleton == nullptr)
+	{
+		return AnimSequences;
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	const FString SkeletonPath = FAssetData(Skeleton).GetExportTextName();
+
+	TArray<FAssetData> AnimSequenceAssets;
+	AssetRegistryModule.Get().GetAssetsByClass(UAnimSequence::StaticClass()->GetFName(), AnimSequenceAssets);
+
+	for (const FAssetData& AnimSequenceAsset : AnimSequenceAssets)
+	{
+		// Filter by the (searchable) skeleton tag first, to avoid loading animation sequences of other skeletons
+		if (AnimSequenceAsset.GetTagValueRef<FString>(TEXT("Skeleton")) != SkeletonPath)
+		{
+			continue;
+		}
+
+		UAnimSequence* AnimSequence = Cast<UAnimSequence>(AnimSequenceAsset.GetAsset());
+		if (AnimSequence != nullptr)
+		{
+			AnimSequences.Add(AnimSequence);
+		}
+	}
+
+	return AnimSequences;
+}
+
 TArray<UWorld*> FGLTFExporterUtility::GetReferencedWorlds(const UObject* Object)
 {
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -6,11 +6,14 @@ class UStaticMesh;
 class UMaterialInterface;
 class UAnimSequence;
 class ULevelSequence;
+class USkeleton;
 
 struct FGLTFExporterUtility
 {
 	static const UStaticMesh* GetPreviewMesh(const UMaterialInterface* Material);
 	static const USkeletalMesh* GetPreviewMesh(const UAnimSequence* AnimSequence);
 
+	static TArray<UAnimSequence*> GetAnimSequences(const USkeleton* Skeleton);
+
 	static TArray<UWorld*> GetReferencedWorlds(const UObject* LevelSequence);
 };
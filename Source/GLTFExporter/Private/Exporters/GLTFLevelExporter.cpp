@@ -2,7 +2,158 @@
 
 #include "Exporters/GLTFLevelExporter.h"
 #include "Builders/GLTFContainerBuilder.h"
+#include "Builders/GLTFFileUtility.h"
+#include "Converters/GLTFConverterUtility.h"
+#include "Converters/GLTFTileUtility.h"
 #include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	struct FGLTFTileNode
+	{
+		FBox Bounds;
+		TSharedRef<FJsonObject> JsonObject;
+	};
+
+	TArray<TSharedPtr<FJsonValue>> CreateJsonArray(const FGLTFVector3& Vector)
+	{
+		return
+		{
+			MakeShared<FJsonValueNumber>(Vector.X),
+			MakeShared<FJsonValueNumber>(Vector.Y),
+			MakeShared<FJsonValueNumber>(Vector.Z)
+		};
+	}
+
+	void SetJsonBounds(const TSharedRef<FJsonObject>& JsonObject, const FBox& Bounds, float ExportScale)
+	{
+		// Converting to glTF only swaps axes, which means the minimum and maximum corners are preserved
+		JsonObject->SetArrayField(TEXT("min"), CreateJsonArray(FGLTFConverterUtility::ConvertPosition(Bounds.Min, ExportScale)));
+		JsonObject->SetArrayField(TEXT("max"), CreateJsonArray(FGLTFConverterUtility::ConvertPosition(Bounds.Max, ExportScale)));
+	}
+
+	bool ExportTile(FGLTFContainerBuilder& Builder, const UWorld* World, const FIntVector& Tile, const FString& TilePath)
+	{
+		FGLTFContainerBuilder TileBuilder(TilePath, Builder.ExportOptions, Builder.bSelectedActorsOnly);
+		TileBuilder.ExportTile = Tile;
+		TileBuilder.ShareImageFiles(Builder);
+
+		const FGLTFJsonSceneIndex SceneIndex = TileBuilder.GetOrAddScene(World);
+		bool bSuccess = SceneIndex != INDEX_NONE;
+
+		if (bSuccess)
+		{
+			TileBuilder.DefaultScene = SceneIndex;
+
+			const TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*TilePath));
+			if (Archive.IsValid())
+			{
+				TileBuilder.Write(*Archive, GWarn);
+			}
+			else
+			{
+				TileBuilder.AddErrorMessage(FString::Printf(TEXT("Failed to write tile to file: %s"), *TilePath));
+				bSuccess = false;
+			}
+		}
+
+		for (const FGLTFMessageBuilder::FLogMessage& Message : TileBuilder.GetMessages())
+		{
+			Builder.AddMessage(Message.Get<0>(), Message.Get<1>());
+		}
+
+		return bSuccess;
+	}
+
+	bool ExportTiles(FGLTFContainerBuilder& Builder, const UWorld* World)
+	{
+		const float TileSize = Builder.ExportOptions->LevelTileSize;
+		const float ExportScale = Builder.ExportOptions->ExportUniformScale;
+
+		TMap<FIntVector, FBox> TileBounds;
+		FGLTFTileUtility::GetTileBounds(World, Builder.bSelectedActorsOnly, TileSize, TileBounds);
+
+		if (TileBounds.Num() == 0)
+		{
+			return true;
+		}
+
+		FIntVector MinTile = TileBounds.CreateConstIterator().Key();
+		for (const TPair<FIntVector, FBox>& Pair : TileBounds)
+		{
+			MinTile = FIntVector(FMath::Min(MinTile.X, Pair.Key.X), FMath::Min(MinTile.Y, Pair.Key.Y), FMath::Min(MinTile.Z, Pair.Key.Z));
+		}
+
+		// Tiles are exported one after another, since conversion (e.g. material baking) must happen on the game thread
+		TMap<FIntVector, FGLTFTileNode> Nodes;
+
+		for (const TPair<FIntVector, FBox>& Pair : TileBounds)
+		{
+			const FString TilePath = FGLTFTileUtility::GetTileFilePath(Builder.FilePath, Pair.Key);
+			if (!ExportTile(Builder, World, Pair.Key, TilePath))
+			{
+				Builder.AddErrorMessage(FString::Printf(TEXT("Failed to export tile %s of level %s"), *Pair.Key.ToString(), *World->GetName()));
+				return false;
+			}
+
+			const TSharedRef<FJsonObject> JsonTile = MakeShared<FJsonObject>();
+			JsonTile->SetStringField(TEXT("uri"), FPaths::GetCleanFilename(TilePath));
+			SetJsonBounds(JsonTile, Pair.Value, ExportScale);
+
+			Nodes.Add(Pair.Key - MinTile, { Pair.Value, JsonTile });
+		}
+
+		// Tiles are grouped into an octree of bounding volumes, merging 2x2x2 cells at each level until a single root remains
+		while (Nodes.Num() > 1)
+		{
+			TMap<FIntVector, FBox> ParentBounds;
+			TMap<FIntVector, TArray<TSharedPtr<FJsonValue>>> ParentChildren;
+
+			for (const TPair<FIntVector, FGLTFTileNode>& Pair : Nodes)
+			{
+				const FIntVector ParentKey(Pair.Key.X / 2, Pair.Key.Y / 2, Pair.Key.Z / 2);
+
+				if (FBox* Bounds = ParentBounds.Find(ParentKey))
+				{
+					*Bounds += Pair.Value.Bounds;
+				}
+				else
+				{
+					ParentBounds.Add(ParentKey, Pair.Value.Bounds);
+				}
+
+				ParentChildren.FindOrAdd(ParentKey).Add(MakeShared<FJsonValueObject>(Pair.Value.JsonObject));
+			}
+
+			Nodes.Reset();
+
+			for (const TPair<FIntVector, FBox>& Pair : ParentBounds)
+			{
+				const TSharedRef<FJsonObject> JsonNode = MakeShared<FJsonObject>();
+				SetJsonBounds(JsonNode, Pair.Value, ExportScale);
+				JsonNode->SetArrayField(TEXT("children"), ParentChildren[Pair.Key]);
+
+				Nodes.Add(Pair.Key, { Pair.Value, JsonNode });
+			}
+		}
+
+		const TSharedRef<FJsonObject> JsonManifest = MakeShared<FJsonObject>();
+		JsonManifest->SetStringField(TEXT("common"), FPaths::GetCleanFilename(Builder.FilePath));
+		JsonManifest->SetNumberField(TEXT("tileSize"), FGLTFConverterUtility::ConvertLength(TileSize, ExportScale));
+		JsonManifest->SetObjectField(TEXT("root"), Nodes.CreateConstIterator().Value().JsonObject);
+
+		const FString ManifestPath = FPaths::ChangeExtension(Builder.FilePath, TEXT("tiles.json"));
+		if (!FGLTFFileUtility::WriteJsonFile(ManifestPath, JsonManifest))
+		{
+			Builder.AddErrorMessage(FString::Printf(TEXT("Failed to write tile manifest to file: %s"), *ManifestPath));
+			return false;
+		}
+
+		return true;
+	}
+}
 
 UGLTFLevelExporter::UGLTFLevelExporter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -14,6 +165,12 @@ bool UGLTFLevelExporter::AddObject(FGLTFContainerBuilder& Builder, const UObject
 {
 	const UWorld* World = CastChecked<UWorld>(Object);
 
+	// When exporting tiles, the scene of the builder only holds actors without bounds (e.g. lights), and every tile is written to its own file
+	if (FGLTFTileUtility::ShouldExportTiles(Builder.ExportOptions) && !ExportTiles(Builder, World))
+	{
+		return false;
+	}
+
 	const FGLTFJsonSceneIndex SceneIndex = Builder.GetOrAddScene(World);
 	if (SceneIndex == INDEX_NONE)
 	{
@@ -1,8 +1,102 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Exporters/GLTFSkeletalMeshExporter.h"
+#include "Exporters/GLTFExporterUtility.h"
+#include "GLTFExportOptions.h"
 #include "Builders/GLTFContainerBuilder.h"
+#include "Converters/GLTFMeshUtility.h"
+#include "Converters/GLTFJointPaletteUtility.h"
 #include "Engine/SkeletalMesh.h"
+#include "Animation/AnimSequence.h"
+#include "UObject/GCObjectScopeGuard.h"
+#include "HAL/FileManager.h"
+
+namespace
+{
+	FGLTFJsonNodeIndex AddSkeletalMesh(FGLTFContainerBuilder& Builder, const USkeletalMesh* SkeletalMesh)
+	{
+		const bool bSplitJointPalettes = FGLTFJointPaletteUtility::CanSplitMesh(Builder, nullptr);
+		const int32 LODIndex = FGLTFMeshUtility::GetLOD(SkeletalMesh, nullptr, Builder.ExportOptions->DefaultLevelOfDetail);
+
+		const FGLTFJsonMeshIndex MeshIndex = Builder.GetOrAddMesh(SkeletalMesh, {}, LODIndex, bSplitJointPalettes ? 0 : INDEX_NONE);
+		if (MeshIndex == INDEX_NONE)
+		{
+			Builder.AddErrorMessage(FString::Printf(TEXT("Failed to export skeletal mesh %s"), *SkeletalMesh->GetName()));
+			return FGLTFJsonNodeIndex(INDEX_NONE);
+		}
+
+		FGLTFJsonNode Node;
+		Node.Mesh = MeshIndex;
+		const FGLTFJsonNodeIndex NodeIndex = Builder.AddNode(Node);
+
+		if (Builder.ExportOptions->bExportVertexSkinWeights)
+		{
+			TArray<FGLTFJsonNodeIndex> MeshNodeIndices;
+			TArray<const FGLTFSkinJoints*> MeshNodePalettes;
+
+			if (bSplitJointPalettes)
+			{
+				FGLTFJointPaletteUtility::AddPaletteNodes(Builder, NodeIndex, SkeletalMesh, nullptr, LODIndex, MeshNodeIndices, MeshNodePalettes);
+			}
+			else
+			{
+				MeshNodeIndices.Add(NodeIndex);
+				MeshNodePalettes.Add(nullptr);
+			}
+
+			for (int32 Index = 0; Index < MeshNodeIndices.Num(); ++Index)
+			{
+				const FGLTFJsonSkinIndex SkinIndex = Builder.GetOrAddSkin(NodeIndex, SkeletalMesh, MeshNodePalettes[Index]);
+				if (SkinIndex == INDEX_NONE)
+				{
+					Builder.AddErrorMessage(FString::Printf(TEXT("Failed to export bones in skeletal mesh %s"), *SkeletalMesh->GetName()));
+					return FGLTFJsonNodeIndex(INDEX_NONE);
+				}
+
+				Builder.GetNode(MeshNodeIndices[Index]).Skin = SkinIndex;
+			}
+		}
+
+		FGLTFJsonScene Scene;
+		Scene.Nodes.Add(NodeIndex);
+		const FGLTFJsonSceneIndex SceneIndex = Builder.AddScene(Scene);
+
+		Builder.DefaultScene = SceneIndex;
+		return NodeIndex;
+	}
+
+	// All animations target the joint nodes of the same skin, which means joints and inverse bind matrices are only exported once
+	void AddAnimations(FGLTFContainerBuilder& Builder, FGLTFJsonNodeIndex NodeIndex, const USkeletalMesh* SkeletalMesh, const TArray<UAnimSequence*>& AnimSequences)
+	{
+		for (const UAnimSequence* AnimSequence : AnimSequences)
+		{
+			if (AnimSequence == nullptr)
+			{
+				continue;
+			}
+
+			if (AnimSequence->GetSkeleton() != SkeletalMesh->Skeleton)
+			{
+				Builder.AddWarningMessage(
+					FString::Printf(TEXT("Animation sequence %s skipped because its skeleton doesn't match skeletal mesh %s"),
+					*AnimSequence->GetName(),
+					*SkeletalMesh->GetName()));
+				continue;
+			}
+
+			const FGLTFJsonAnimationIndex AnimationIndex = Builder.GetOrAddAnimation(NodeIndex, SkeletalMesh, AnimSequence);
+			if (AnimationIndex == INDEX_NONE)
+			{
+				Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export animation sequence %s"), *AnimSequence->GetName()));
+			}
+		}
+	}
+
+	bool CanExportAnimations(const FGLTFContainerBuilder& Builder)
+	{
+		return Builder.ExportOptions->bExportAnimationSequences && Builder.ExportOptions->bExportVertexSkinWeights;
+	}
+}
 
 UGLTFSkeletalMeshExporter::UGLTFSkeletalMeshExporter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -14,33 +108,67 @@ bool UGLTFSkeletalMeshExporter::AddObject(FGLTFContainerBuilder& Builder, const
 {
 	const USkeletalMesh* SkeletalMesh = CastChecked<USkeletalMesh>(Object);
 
-	const FGLTFJsonMeshIndex MeshIndex = Builder.GetOrAddMesh(SkeletalMesh);
-	if (MeshIndex == INDEX_NONE)
+	const FGLTFJsonNodeIndex NodeIndex = AddSkeletalMesh(Builder, SkeletalMesh);
+	if (NodeIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (Builder.ExportOptions->bExportAnimationLibrary && CanExportAnimations(Builder))
+	{
+		AddAnimations(Builder, NodeIndex, SkeletalMesh, FGLTFExporterUtility::GetAnimSequences(SkeletalMesh->Skeleton));
+	}
+
+	return true;
+}
+
+bool UGLTFSkeletalMeshExporter::ExportAnimationLibrary(const USkeletalMesh* SkeletalMesh, const TArray<UAnimSequence*>& AnimSequences, const FString& FilePath, const UGLTFExportOptions* Options)
+{
+	if (SkeletalMesh == nullptr)
 	{
-		Builder.AddErrorMessage(FString::Printf(TEXT("Failed to export skeletal mesh %s"), *SkeletalMesh->GetName()));
 		return false;
 	}
 
-	FGLTFJsonNode Node;
-	Node.Mesh = MeshIndex;
-	const FGLTFJsonNodeIndex NodeIndex = Builder.AddNode(Node);
+	const UGLTFExportOptions* ExportOptions = Options != nullptr ? Options : NewObject<UGLTFExportOptions>();
+	FGCObjectScopeGuard OptionsGuard(ExportOptions);
+	FGLTFContainerBuilder Builder(FilePath, ExportOptions, false);
+
+	bool bSuccess = false;
 
-	if (Builder.ExportOptions->bExportVertexSkinWeights)
+	if (!CanExportAnimations(Builder))
 	{
-		const FGLTFJsonSkinIndex SkinIndex = Builder.GetOrAddSkin(NodeIndex, SkeletalMesh);
-		if (SkinIndex == INDEX_NONE)
+		Builder.AddErrorMessage(
+			FString::Printf(TEXT("Failed to export animation library for skeletal mesh %s because animation sequences or vertex skin weights are disabled by export options"),
+			*SkeletalMesh->GetName()));
+	}
+	else
+	{
+		const FGLTFJsonNodeIndex NodeIndex = AddSkeletalMesh(Builder, SkeletalMesh);
+		if (NodeIndex != INDEX_NONE)
 		{
-			Builder.AddErrorMessage(FString::Printf(TEXT("Failed to export bones in skeletal mesh %s"), *SkeletalMesh->GetName()));
-			return false;
-		}
+			AddAnimations(Builder, NodeIndex, SkeletalMesh, AnimSequences.Num() > 0 ? AnimSequences : FGLTFExporterUtility::GetAnimSequences(SkeletalMesh->Skeleton));
 
-		Builder.GetNode(NodeIndex).Skin = SkinIndex;
+			const TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+			if (Archive.IsValid())
+			{
+				Builder.Write(*Archive, GWarn);
+				bSuccess = true;
+			}
+			else
+			{
+				Builder.AddErrorMessage(FString::Printf(TEXT("Failed to write animation library to file: %s"), *FilePath));
+			}
+		}
 	}
 
-	FGLTFJsonScene Scene;
-	Scene.Nodes.Add(NodeIndex);
-	const FGLTFJsonSceneIndex SceneIndex = Builder.AddScene(Scene);
+	if (FApp::IsUnattended())
+	{
+		Builder.WriteMessagesToConsole();
+	}
+	else
+	{
+		Builder.ShowMessages();
+	}
 
-	Builder.DefaultScene = SceneIndex;
-	return true;
+	return bSuccess;
 }
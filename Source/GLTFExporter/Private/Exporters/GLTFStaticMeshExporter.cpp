@@ -14,16 +14,15 @@ bool UGLTFStaticMeshExporter::AddObject(FGLTFContainerBuilder& Builder, const UO
 {
 	const UStaticMesh* StaticMesh = CastChecked<UStaticMesh>(Object);
 
-	const FGLTFJsonMeshIndex MeshIndex = Builder.GetOrAddMesh(StaticMesh);
+	const FGLTFJsonMeshIndex MeshIndex = Builder.GetOrAddMesh(StaticMesh, {}, -1, true);
 	if (MeshIndex == INDEX_NONE)
 	{
 		Builder.AddErrorMessage(FString::Printf(TEXT("Failed to export static mesh %s"), *StaticMesh->GetName()));
 		return false;
 	}
 
-	FGLTFJsonNode Node;
-	Node.Mesh = MeshIndex;
-	const FGLTFJsonNodeIndex NodeIndex = Builder.AddNode(Node);
+	const FGLTFJsonNodeIndex NodeIndex = Builder.AddNode();
+	Builder.SetNodeMesh(NodeIndex, MeshIndex);
 
 	FGLTFJsonScene Scene;
 	Scene.Nodes.Add(NodeIndex);
@@ -24,13 +24,34 @@ void UGLTFExportOptions::ResetToDefault()
 	DefaultMaterialBakeSize = EGLTFMaterialBakeSizePOT::POT_1024;
 	DefaultMaterialBakeFilter = TF_Trilinear;
 	DefaultMaterialBakeTiling = TA_Wrap;
+	bExportLevelsOfDetail = false;
+	MaximumLevelOfDetail = -1;
 	bExportVertexColors = false;
 	bExportVertexSkinWeights = true;
+	MaximumBoneInfluences = 0;
+	bStripUnusedBones = false;
+	MaximumJointsPerPrimitive = 0;
+	bExportMorphTargets = false;
+	MeshSimplificationRatio = 1.0f;
+	MaximumMeshTriangleCount = 0;
+	SceneTriangleBudget = 0;
 	bUseMeshQuantization = false;
+	PositionQuantizationTolerance = 0.01f;
+	TexCoordQuantizationTolerance = 0.0001f;
+	bShareVertexStreams = false;
 	bExportLevelSequences = true;
+	bExportLevelSequenceKeys = false;
 	bExportAnimationSequences = true;
 	bRetargetBoneTransforms = true;
+	AnimationSampleRate = 0;
+	bExportAnimationLibrary = false;
 	bExportPlaybackSettings = false;
+	bReduceAnimationKeys = false;
+	AnimationTranslationTolerance = 0.01f;
+	AnimationRotationTolerance = 0.05f;
+	AnimationScaleTolerance = 0.001f;
+	bUseAnimationQuantization = false;
+	RotationQuantizationTolerance = 0.01f;
 	TextureImageFormat = EGLTFTextureImageFormat::PNG;
 	TextureImageQuality = 0;
 	NoLossyImageFormatFor = static_cast<int32>(EGLTFTextureType::All);
@@ -38,6 +59,13 @@ void UGLTFExportOptions::ResetToDefault()
 	bExportLightmaps = false;
 	TextureHDREncoding = EGLTFTextureHDREncoding::None;
 	bExportHiddenInGame = false;
+	bExportMeshInstances = false;
+	bInstanceRepeatedMeshes = false;
+	bBatchStaticMeshes = false;
+	StaticMeshBatchClusterSize = 5000.0f;
+	bExportLevelTiles = false;
+	LevelTileSize = 10000.0f;
+	ActorsPerExportPass = 0;
 	ExportLights = static_cast<int32>(EGLTFSceneMobility::Stationary | EGLTFSceneMobility::Movable);
 	bExportCameras = true;
 	bExportCameraControls = false;
@@ -21,6 +21,12 @@ struct FGLTFJsonAccessor : IGLTFJsonObject
 	float Min[16];
 	float Max[16];
 
+	// Elements (given by index) that replace the values of the buffer view, or zeros if there is no buffer view
+	int32                    SparseCount;
+	FGLTFJsonBufferViewIndex SparseIndices;
+	EGLTFJsonComponentType   SparseIndexComponentType;
+	FGLTFJsonBufferViewIndex SparseValues;
+
 	FGLTFJsonAccessor()
 		: ByteOffset(0)
 		, Count(0)
@@ -30,6 +36,8 @@ struct FGLTFJsonAccessor : IGLTFJsonObject
 		, MinMaxLength(0)
 		, Min{0}
 		, Max{0}
+		, SparseCount(0)
+		, SparseIndexComponentType(EGLTFJsonComponentType::None)
 	{
 	}
 
@@ -40,7 +48,10 @@ struct FGLTFJsonAccessor : IGLTFJsonObject
 			Writer.Write(TEXT("name"), Name);
 		}
 
-		Writer.Write(TEXT("bufferView"), BufferView);
+		if (BufferView != INDEX_NONE)
+		{
+			Writer.Write(TEXT("bufferView"), BufferView);
+		}
 
 		if (ByteOffset != 0)
 		{
@@ -61,5 +72,22 @@ struct FGLTFJsonAccessor : IGLTFJsonObject
 			Writer.Write(TEXT("min"), Min, MinMaxLength);
 			Writer.Write(TEXT("max"), Max, MinMaxLength);
 		}
+
+		if (SparseCount > 0)
+		{
+			Writer.StartObject(TEXT("sparse"));
+			Writer.Write(TEXT("count"), SparseCount);
+
+			Writer.StartObject(TEXT("indices"));
+			Writer.Write(TEXT("bufferView"), SparseIndices);
+			Writer.Write(TEXT("componentType"), SparseIndexComponentType);
+			Writer.EndObject();
+
+			Writer.StartObject(TEXT("values"));
+			Writer.Write(TEXT("bufferView"), SparseValues);
+			Writer.EndObject();
+
+			Writer.EndObject();
+		}
 	}
 };
@@ -11,6 +11,8 @@ enum class EGLTFJsonExtension
 	KHR_MaterialsUnlit,
 	KHR_MeshQuantization,
 	KHR_TextureTransform,
+	MSFT_Lod,
+	EXT_MeshGPUInstancing,
 	EPIC_AnimationHotspots,
 	EPIC_AnimationPlayback,
 	EPIC_BlendModes,
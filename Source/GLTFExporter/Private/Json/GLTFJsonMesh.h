@@ -5,6 +5,7 @@
 #include "Json/GLTFJsonObject.h"
 #include "Json/GLTFJsonEnums.h"
 #include "Json/GLTFJsonIndex.h"
+#include "Json/GLTFJsonVector.h"
 
 struct FGLTFJsonAttributes : IGLTFJsonObject
 {
@@ -43,6 +44,39 @@ struct FGLTFJsonAttributes : IGLTFJsonObject
 	}
 };
 
+struct FGLTFJsonMorphTarget : IGLTFJsonObject
+{
+	FGLTFJsonAccessorIndex Position;
+	FGLTFJsonAccessorIndex Normal;
+
+	virtual void WriteObject(IGLTFJsonWriter& Writer) const override
+	{
+		if (Position != INDEX_NONE) Writer.Write(TEXT("POSITION"), Position);
+		if (Normal != INDEX_NONE) Writer.Write(TEXT("NORMAL"), Normal);
+	}
+};
+
+// Range of indices in a batched primitive that originates from a single source actor
+struct FGLTFJsonBatchedActor : IGLTFJsonObject
+{
+	FString Name;
+	int32 FirstIndex;
+	int32 IndexCount;
+
+	FGLTFJsonBatchedActor()
+		: FirstIndex(0)
+		, IndexCount(0)
+	{
+	}
+
+	virtual void WriteObject(IGLTFJsonWriter& Writer) const override
+	{
+		Writer.Write(TEXT("name"), Name);
+		Writer.Write(TEXT("firstIndex"), FirstIndex);
+		Writer.Write(TEXT("indexCount"), IndexCount);
+	}
+};
+
 struct FGLTFJsonPrimitive : IGLTFJsonObject
 {
 	FGLTFJsonAccessorIndex Indices;
@@ -50,6 +84,11 @@ struct FGLTFJsonPrimitive : IGLTFJsonObject
 	EGLTFJsonPrimitiveMode Mode;
 	FGLTFJsonAttributes    Attributes;
 
+	TArray<FGLTFJsonMorphTarget> Targets;
+
+	// Source actors of the index ranges of a batched primitive, written as extras since glTF has no property for them
+	TArray<FGLTFJsonBatchedActor> BatchedActors;
+
 	FGLTFJsonPrimitive()
 		: Mode(EGLTFJsonPrimitiveMode::Triangles)
 	{
@@ -73,6 +112,18 @@ struct FGLTFJsonPrimitive : IGLTFJsonObject
 		{
 			Writer.Write(TEXT("mode"), Mode);
 		}
+
+		if (Targets.Num() > 0)
+		{
+			Writer.Write(TEXT("targets"), Targets);
+		}
+
+		if (BatchedActors.Num() > 0)
+		{
+			Writer.StartObject(TEXT("extras"));
+			Writer.Write(TEXT("batchedActors"), BatchedActors);
+			Writer.EndObject();
+		}
 	}
 };
 
@@ -82,6 +133,21 @@ struct FGLTFJsonMesh : IGLTFJsonObject
 
 	TArray<FGLTFJsonPrimitive> Primitives;
 
+	// Names of the morph targets (shared by all primitives), written as extras since glTF has no property for them
+	TArray<FString> TargetNames;
+
+	// Transform (not written) that nodes instancing this mesh must apply to dequantize its positions
+	bool bQuantizedPositions;
+	FGLTFJsonVector3 DequantizationTranslation;
+	FGLTFJsonVector3 DequantizationScale;
+
+	FGLTFJsonMesh()
+		: bQuantizedPositions(false)
+		, DequantizationTranslation(FGLTFJsonVector3::Zero)
+		, DequantizationScale(FGLTFJsonVector3::One)
+	{
+	}
+
 	virtual void WriteObject(IGLTFJsonWriter& Writer) const override
 	{
 		if (!Name.IsEmpty())
@@ -90,5 +156,12 @@ struct FGLTFJsonMesh : IGLTFJsonObject
 		}
 
 		Writer.Write(TEXT("primitives"), Primitives);
+
+		if (TargetNames.Num() > 0)
+		{
+			Writer.StartObject(TEXT("extras"));
+			Writer.Write(TEXT("targetNames"), TargetNames);
+			Writer.EndObject();
+		}
 	}
 };
@@ -28,6 +28,18 @@ struct FGLTFJsonNode : IGLTFJsonObject
 
 	TArray<FGLTFJsonNodeIndex> Children;
 
+	// Morph target weights that override the default weights of the mesh
+	TArray<float> Weights;
+
+	// Lower levels of detail that replace this node, and the minimum screen coverage of each level (starting with this node)
+	TArray<FGLTFJsonNodeIndex> LODs;
+	TArray<float> LODScreenCoverages;
+
+	// Per-instance transforms of the mesh, each applied before the transform of this node
+	FGLTFJsonAccessorIndex InstanceTranslations;
+	FGLTFJsonAccessorIndex InstanceRotations;
+	FGLTFJsonAccessorIndex InstanceScales;
+
 	FGLTFJsonNode()
 		: Translation(FGLTFJsonVector3::Zero)
 		, Rotation(FGLTFJsonQuaternion::Identity)
@@ -72,10 +84,33 @@ struct FGLTFJsonNode : IGLTFJsonObject
 			Writer.Write(TEXT("mesh"), Mesh);
 		}
 
-		if (Backdrop != INDEX_NONE || Hotspot != INDEX_NONE || Light != INDEX_NONE || LightMap != INDEX_NONE || SkySphere != INDEX_NONE)
+		if (Weights.Num() > 0)
+		{
+			Writer.Write(TEXT("weights"), Weights);
+		}
+
+		if (Backdrop != INDEX_NONE || Hotspot != INDEX_NONE || Light != INDEX_NONE || LightMap != INDEX_NONE || SkySphere != INDEX_NONE || LODs.Num() > 0 || InstanceTranslations != INDEX_NONE)
 		{
 			Writer.StartExtensions();
 
+			if (LODs.Num() > 0)
+			{
+				Writer.StartExtension(EGLTFJsonExtension::MSFT_Lod);
+				Writer.Write(TEXT("ids"), LODs);
+				Writer.EndExtension();
+			}
+
+			if (InstanceTranslations != INDEX_NONE)
+			{
+				Writer.StartExtension(EGLTFJsonExtension::EXT_MeshGPUInstancing);
+				Writer.StartObject(TEXT("attributes"));
+				Writer.Write(TEXT("TRANSLATION"), InstanceTranslations);
+				Writer.Write(TEXT("ROTATION"), InstanceRotations);
+				Writer.Write(TEXT("SCALE"), InstanceScales);
+				Writer.EndObject();
+				Writer.EndExtension();
+			}
+
 			if (Backdrop != INDEX_NONE)
 			{
 				Writer.StartExtension(EGLTFJsonExtension::EPIC_HDRIBackdrops);
@@ -118,5 +153,12 @@ struct FGLTFJsonNode : IGLTFJsonObject
 		{
 			Writer.Write(TEXT("children"), Children);
 		}
+
+		if (LODScreenCoverages.Num() > 0)
+		{
+			Writer.StartObject(TEXT("extras"));
+			Writer.Write(TEXT("MSFT_screencoverage"), LODScreenCoverages);
+			Writer.EndObject();
+		}
 	}
 };
@@ -21,6 +21,8 @@ struct FGLTFJsonUtility
 			case EGLTFJsonExtension::KHR_MaterialsUnlit:      return TEXT("KHR_materials_unlit");
 			case EGLTFJsonExtension::KHR_MeshQuantization:    return TEXT("KHR_mesh_quantization");
 			case EGLTFJsonExtension::KHR_TextureTransform:    return TEXT("KHR_texture_transform");
+			case EGLTFJsonExtension::MSFT_Lod:                return TEXT("MSFT_lod");
+			case EGLTFJsonExtension::EXT_MeshGPUInstancing:   return TEXT("EXT_mesh_gpu_instancing");
 			case EGLTFJsonExtension::EPIC_AnimationHotspots:  return TEXT("EPIC_animation_hotspots");
 			case EGLTFJsonExtension::EPIC_AnimationPlayback:  return TEXT("EPIC_animation_playback");
 			case EGLTFJsonExtension::EPIC_BlendModes:         return TEXT("EPIC_blend_modes");
@@ -4,6 +4,9 @@
 #include "Builders/GLTFContainerBuilder.h"
 #include "Converters/GLTFConverterUtility.h"
 #include "Converters/GLTFBoneUtility.h"
+#include "Converters/GLTFKeyReductionUtility.h"
+#include "Converters/GLTFCurveUtility.h"
+#include "Async/ParallelFor.h"
 #include "LevelSequence.h"
 #include "LevelSequencePlayer.h"
 #include "MovieSceneTimeHelpers.h"
@@ -15,13 +18,278 @@
 using namespace UE;
 #endif
 
+namespace
+{
+	// Keys of the transform of a single node (in glTF space), and the indices of the keys that will be exported for each of its channels
+	struct FGLTFTransformKeys
+	{
+		FGLTFJsonNodeIndex NodeIndex;
+
+		TArray<FGLTFVector3> Translations;
+		TArray<FGLTFQuaternion> Rotations;
+		TArray<FGLTFVector3> Scales;
+
+		TArray<int32> TranslationKeys;
+		TArray<int32> RotationKeys;
+		TArray<int32> ScaleKeys;
+	};
+
+	void AddChannel(FGLTFJsonAnimation& JsonAnimation, FGLTFJsonNodeIndex NodeIndex, EGLTFJsonTargetPath Path, EGLTFJsonInterpolation Interpolation, FGLTFJsonAccessorIndex Input, FGLTFJsonAccessorIndex Output)
+	{
+		FGLTFJsonAnimationSampler JsonSampler;
+		JsonSampler.Input = Input;
+		JsonSampler.Output = Output;
+		JsonSampler.Interpolation = Interpolation;
+
+		FGLTFJsonAnimationChannel JsonChannel;
+		JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
+		JsonChannel.Target.Path = Path;
+		JsonChannel.Target.Node = NodeIndex;
+		JsonAnimation.Channels.Add(JsonChannel);
+	}
+
+	template <typename ValueType>
+	void AddChannel(FGLTFConvertBuilder& Builder, FGLTFJsonAnimation& JsonAnimation, const TArray<float>& Timestamps, FGLTFJsonNodeIndex NodeIndex, EGLTFJsonTargetPath Path,
+		EGLTFJsonInterpolation Interpolation, const TArray<ValueType>& Values, const TArray<int32>& Keys)
+	{
+		if (Keys.Num() == 0)
+		{
+			return;
+		}
+
+		FGLTFJsonAccessorIndex Input;
+		FGLTFJsonAccessorIndex Output;
+
+		if (Keys.Num() == Values.Num())
+		{
+			Input = Builder.GetOrAddAnimationInputAccessor(MakeArrayView(Timestamps.GetData(), Keys.Num()));
+			Output = Builder.GetOrAddAnimationOutputAccessor(MakeArrayView(Values.GetData(), Values.Num()));
+		}
+		else
+		{
+			TArray<float> KeyTimestamps;
+			TArray<ValueType> KeyValues;
+			KeyTimestamps.Reserve(Keys.Num());
+			KeyValues.Reserve(Keys.Num());
+
+			for (int32 Key : Keys)
+			{
+				KeyTimestamps.Add(Timestamps[Key]);
+				KeyValues.Add(Values[Key]);
+			}
+
+			Input = Builder.GetOrAddAnimationInputAccessor(MakeArrayView(KeyTimestamps.GetData(), KeyTimestamps.Num()));
+			Output = Builder.GetOrAddAnimationOutputAccessor(MakeArrayView(KeyValues.GetData(), KeyValues.Num()));
+		}
+
+		AddChannel(JsonAnimation, NodeIndex, Path, Interpolation, Input, Output);
+	}
+
+	// Exports the keys of the given translation or scale channels as-is (instead of sampling them), if they can be represented by a cubic spline
+	bool AddCubicSplineChannel(FGLTFConvertBuilder& Builder, FGLTFJsonAnimation& JsonAnimation, FGLTFJsonNodeIndex NodeIndex, EGLTFJsonTargetPath Path,
+		TArrayView<FMovieSceneFloatChannel*> Channels, FFrameNumber StartFrame, FFrameNumber EndFrame, FFrameRate TickResolution)
+	{
+		if (!Builder.ExportOptions->bExportLevelSequenceKeys)
+		{
+			return false;
+		}
+
+		TArray<float> Timestamps;
+		TArray<FVector> KeyValues;
+
+		if (!FGLTFCurveUtility::GetCubicSplineKeys(Channels, StartFrame, EndFrame, TickResolution, Timestamps, KeyValues))
+		{
+			return false;
+		}
+
+		TArray<FGLTFVector3> Values;
+		Values.AddUninitialized(KeyValues.Num());
+
+		for (int32 Index = 0; Index < KeyValues.Num(); ++Index)
+		{
+			// Tangents are converted like values, since both conversions are linear
+			Values[Index] = Path == EGLTFJsonTargetPath::Translation
+				? FGLTFConverterUtility::ConvertPosition(KeyValues[Index], Builder.ExportOptions->ExportUniformScale)
+				: FGLTFConverterUtility::ConvertScale(KeyValues[Index]);
+		}
+
+		const FGLTFJsonAccessorIndex Input = Builder.GetOrAddAnimationInputAccessor(MakeArrayView(Timestamps.GetData(), Timestamps.Num()));
+		const FGLTFJsonAccessorIndex Output = Builder.GetOrAddAnimationOutputAccessor(MakeArrayView(Values.GetData(), Values.Num()));
+
+		AddChannel(JsonAnimation, NodeIndex, Path, EGLTFJsonInterpolation::CubicSpline, Input, Output);
+		return true;
+	}
+
+	// Evaluates each of the X, Y, and Z channels across all frames, and writes the results directly into the matching (glTF space) components
+	void EvaluateVectorChannels(TArrayView<FMovieSceneFloatChannel*> Channels, const TArray<FFrameTime>& FrameTimes, float DefaultValue, float Scale, TArray<FGLTFVector3>& OutValues)
+	{
+		// Same swizzle as FGLTFConverterUtility::ConvertVector
+		const int32 ComponentIndices[3] = { 0, 2, 1 };
+
+		for (int32 ChannelIndex = 0; ChannelIndex < 3; ++ChannelIndex)
+		{
+			const FMovieSceneFloatChannel* Channel = Channels[ChannelIndex];
+			const int32 ComponentIndex = ComponentIndices[ChannelIndex];
+
+			for (int32 Frame = 0; Frame < FrameTimes.Num(); ++Frame)
+			{
+				float Value = DefaultValue;
+				Channel->Evaluate(FrameTimes[Frame], Value);
+				OutValues[Frame].Components[ComponentIndex] = Value * Scale;
+			}
+		}
+	}
+
+	void EvaluateRotationChannels(TArrayView<FMovieSceneFloatChannel*> Channels, const TArray<FFrameTime>& FrameTimes, TArray<FGLTFQuaternion>& OutValues)
+	{
+		const int32 FrameCount = FrameTimes.Num();
+
+		// Roll, pitch, and yaw
+		TArray<float> Angles[3];
+
+		for (int32 ChannelIndex = 0; ChannelIndex < 3; ++ChannelIndex)
+		{
+			const FMovieSceneFloatChannel* Channel = Channels[ChannelIndex];
+			TArray<float>& ChannelAngles = Angles[ChannelIndex];
+			ChannelAngles.AddZeroed(FrameCount);
+
+			for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+			{
+				Channel->Evaluate(FrameTimes[Frame], ChannelAngles[Frame]);
+			}
+		}
+
+		TArray<FQuat> Rotations;
+		Rotations.AddUninitialized(FrameCount);
+
+		for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+		{
+			Rotations[Frame] = FRotator(Angles[1][Frame], Angles[2][Frame], Angles[0][Frame]).Quaternion();
+		}
+
+		FGLTFConverterUtility::ConvertRotations(Rotations, OutValues);
+	}
+
+	// Samples the raw keys of a track (i.e. either a single constant key, or one key per raw frame) at the given timestamps
+	template <typename ValueType, typename InterpolateFunctionType>
+	TArray<ValueType> ResampleKeys(const TArray<ValueType>& Keys, const TArray<float>& Timestamps, float SequenceLength, bool bStep, InterpolateFunctionType Interpolate)
+	{
+		if (Keys.Num() <= 1)
+		{
+			return Keys;
+		}
+
+		const int32 LastKey = Keys.Num() - 1;
+
+		TArray<ValueType> ResampledKeys;
+		ResampledKeys.AddUninitialized(Timestamps.Num());
+
+		for (int32 Frame = 0; Frame < Timestamps.Num(); ++Frame)
+		{
+			const float KeyPosition = FMath::Clamp(Timestamps[Frame] / SequenceLength, 0.0f, 1.0f) * LastKey;
+			const int32 Key = FMath::Min(FMath::FloorToInt(KeyPosition), LastKey - 1);
+
+			float Alpha = KeyPosition - Key;
+			if (bStep)
+			{
+				Alpha = Alpha >= 1 ? 1 : 0;
+			}
+
+			ResampledKeys[Frame] = Interpolate(Keys[Key], Keys[Key + 1], Alpha);
+		}
+
+		return ResampledKeys;
+	}
+
+	TArray<int32> GetAllKeys(int32 KeyCount)
+	{
+		TArray<int32> Keys;
+		Keys.AddUninitialized(KeyCount);
+
+		for (int32 Key = 0; Key < KeyCount; ++Key)
+		{
+			Keys[Key] = Key;
+		}
+
+		return Keys;
+	}
+
+	void ReduceKeys(FGLTFConvertBuilder& Builder, const TArray<float>& Timestamps, EGLTFJsonInterpolation Interpolation, TArray<FGLTFTransformKeys>& Tracks)
+	{
+		const UGLTFExportOptions* ExportOptions = Builder.ExportOptions;
+		const float TranslationTolerance = ExportOptions->AnimationTranslationTolerance * ExportOptions->ExportUniformScale;
+		const float RotationTolerance = FMath::DegreesToRadians(ExportOptions->AnimationRotationTolerance);
+		const float ScaleTolerance = ExportOptions->AnimationScaleTolerance;
+
+		ParallelFor(Tracks.Num(), [&Tracks, &Timestamps, Interpolation, TranslationTolerance, RotationTolerance, ScaleTolerance](int32 TrackIndex)
+		{
+			FGLTFTransformKeys& Track = Tracks[TrackIndex];
+			Track.TranslationKeys = FGLTFKeyReductionUtility::ReduceKeys(Timestamps, Track.Translations, Interpolation, TranslationTolerance);
+			Track.RotationKeys = FGLTFKeyReductionUtility::ReduceKeys(Timestamps, Track.Rotations, Interpolation, RotationTolerance);
+			Track.ScaleKeys = FGLTFKeyReductionUtility::ReduceKeys(Timestamps, Track.Scales, Interpolation, ScaleTolerance);
+		});
+
+		// Channels that are constant and equal to the rest pose of their node (i.e. the transform it was exported with) are omitted altogether
+		for (FGLTFTransformKeys& Track : Tracks)
+		{
+			const FGLTFJsonNode& JsonNode = Builder.GetNode(Track.NodeIndex);
+
+			if (Track.TranslationKeys.Num() == 1 && FGLTFKeyReductionUtility::IsNearlyEqual(Track.Translations[Track.TranslationKeys[0]], JsonNode.Translation, TranslationTolerance))
+			{
+				Track.TranslationKeys.Empty();
+			}
+
+			if (Track.RotationKeys.Num() == 1 && FGLTFKeyReductionUtility::IsNearlyEqual(Track.Rotations[Track.RotationKeys[0]], JsonNode.Rotation, RotationTolerance))
+			{
+				Track.RotationKeys.Empty();
+			}
+
+			if (Track.ScaleKeys.Num() == 1 && FGLTFKeyReductionUtility::IsNearlyEqual(Track.Scales[Track.ScaleKeys[0]], JsonNode.Scale, ScaleTolerance))
+			{
+				Track.ScaleKeys.Empty();
+			}
+		}
+	}
+
+	void AddChannels(FGLTFConvertBuilder& Builder, FGLTFJsonAnimation& JsonAnimation, const TArray<float>& Timestamps, EGLTFJsonInterpolation Interpolation, TArray<FGLTFTransformKeys>& Tracks)
+	{
+		if (Builder.ExportOptions->bReduceAnimationKeys)
+		{
+			ReduceKeys(Builder, Timestamps, Interpolation, Tracks);
+		}
+		else
+		{
+			for (FGLTFTransformKeys& Track : Tracks)
+			{
+				Track.TranslationKeys = GetAllKeys(Track.Translations.Num());
+				Track.RotationKeys = GetAllKeys(Track.Rotations.Num());
+				Track.ScaleKeys = GetAllKeys(Track.Scales.Num());
+			}
+		}
+
+		for (const FGLTFTransformKeys& Track : Tracks)
+		{
+			AddChannel(Builder, JsonAnimation, Timestamps, Track.NodeIndex, EGLTFJsonTargetPath::Translation, Interpolation, Track.Translations, Track.TranslationKeys);
+			AddChannel(Builder, JsonAnimation, Timestamps, Track.NodeIndex, EGLTFJsonTargetPath::Rotation, Interpolation, Track.Rotations, Track.RotationKeys);
+			AddChannel(Builder, JsonAnimation, Timestamps, Track.NodeIndex, EGLTFJsonTargetPath::Scale, Interpolation, Track.Scales, Track.ScaleKeys);
+		}
+	}
+}
+
 void FGLTFAnimSequenceTask::Complete()
 {
 	// TODO: bone transforms should be absolute (not relative) according to gltf spec
 
-	const int32 FrameCount = AnimSequence->GetRawNumberOfFrames();
+	const int32 RawFrameCount = AnimSequence->GetRawNumberOfFrames();
+	const float SequenceLength = AnimSequence->SequenceLength;
 	const USkeleton* Skeleton = AnimSequence->GetSkeleton();
 
+	// Only resample when it would reduce the number of frames
+	const int32 SampleRate = Builder.ExportOptions->AnimationSampleRate;
+	const bool bResample = SampleRate > 0 && RawFrameCount > 1 && SequenceLength > 0 && SampleRate < (RawFrameCount - 1) / SequenceLength;
+	// NOTE: tolerance keeps float error in the product (e.g. 245.00002) from adding a frame that would be clamped onto the previous one
+	int32 FrameCount = bResample ? FMath::CeilToInt(SequenceLength * SampleRate - KINDA_SMALL_NUMBER) + 1 : RawFrameCount;
+
 	FGLTFJsonAnimation& JsonAnimation = Builder.GetAnimation(AnimationIndex);
 	JsonAnimation.Name = AnimSequence->GetName() + TEXT("_") + FString::FromInt(AnimationIndex); // Ensure unique name due to limitation in certain gltf viewers
 
@@ -30,17 +298,15 @@ void FGLTFAnimSequenceTask::Complete()
 
 	for (int32 Frame = 0; Frame < FrameCount; ++Frame)
 	{
-		Timestamps[Frame] = AnimSequence->GetTimeAtFrame(Frame);
+		Timestamps[Frame] = bResample ? FMath::Min(Frame / static_cast<float>(SampleRate), SequenceLength) : AnimSequence->GetTimeAtFrame(Frame);
 	}
 
-	// TODO: add animation data accessor converters to reuse track information
-
-	FGLTFJsonAccessor JsonInputAccessor;
-	JsonInputAccessor.BufferView = Builder.AddBufferView(Timestamps);
-	JsonInputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-	JsonInputAccessor.Type = EGLTFJsonAccessorType::Scalar;
-	JsonInputAccessor.MinMaxLength = 1;
-	JsonInputAccessor.Min[0] = 0;
+	// Timestamps must be strictly increasing, so drop a last frame that was clamped onto the previous one
+	if (bResample && FrameCount > 2 && Timestamps[FrameCount - 1] <= Timestamps[FrameCount - 2])
+	{
+		Timestamps.Pop();
+		--FrameCount;
+	}
 
 	FBoneContainer BoneContainer;
 	if (Builder.ExportOptions->bRetargetBoneTransforms)
@@ -58,138 +324,104 @@ void FGLTFAnimSequenceTask::Complete()
 	const TArray<FName>& TrackNames = AnimSequence->GetAnimationTrackNames();
 	const int32 TrackCount = TrackNames.Num();
 
-	for (int32 TrackIndex = 0; TrackIndex < TrackCount; ++TrackIndex)
+	struct FTrackBone
 	{
-		const FRawAnimSequenceTrack& Track = AnimSequence->GetRawAnimationTrack(TrackIndex);
-		const TArray<FVector>& KeyPositions = Track.PosKeys;
-		const TArray<FQuat>& KeyRotations = Track.RotKeys;
-		const TArray<FVector>& KeyScales = Track.ScaleKeys;
+		int32 TrackIndex;
+		int32 SkeletonBoneIndex;
+		int32 BoneIndex;
+	};
 
-		const int32 MaxKeys = FMath::Max3(KeyPositions.Num(), KeyRotations.Num(), KeyScales.Num());
-		if (MaxKeys == 0)
-		{
-			continue;
-		}
+	TArray<FGLTFTransformKeys> Tracks;
+	TArray<FTrackBone> TrackBones;
+	Tracks.Reserve(TrackCount);
+	TrackBones.Reserve(TrackCount);
 
-		TArray<FTransform> KeyTransforms;
-		KeyTransforms.AddUninitialized(MaxKeys);
+	const TArray<int32>& JointIndices = Builder.GetOrAddSkinJoints(SkeletalMesh)->JointIndices;
 
-		for (int32 Key = 0; Key < KeyTransforms.Num(); ++Key)
+	// Nodes are looked up (and possibly added) on the game thread, while the keys of each track are resampled, retargeted, and converted in parallel
+
+	for (int32 TrackIndex = 0; TrackIndex < TrackCount; ++TrackIndex)
+	{
+		const FRawAnimSequenceTrack& Track = AnimSequence->GetRawAnimationTrack(TrackIndex);
+		if (Track.PosKeys.Num() == 0 && Track.RotKeys.Num() == 0 && Track.ScaleKeys.Num() == 0)
 		{
-			const FVector& KeyPosition = KeyPositions.IsValidIndex(Key) ? KeyPositions[Key] : FVector::ZeroVector;
-			const FQuat& KeyRotation = KeyRotations.IsValidIndex(Key) ? KeyRotations[Key] : FQuat::Identity;
-			const FVector& KeyScale = KeyScales.IsValidIndex(Key) ? KeyScales[Key] : FVector::OneVector;
-			KeyTransforms[Key] = { KeyRotation, KeyPosition, KeyScale };
+			continue;
 		}
 
 		const int32 SkeletonBoneIndex = AnimSequence->GetSkeletonIndexFromRawDataTrackIndex(TrackIndex);
 		const int32 BoneIndex = const_cast<USkeleton*>(Skeleton)->GetMeshBoneIndexFromSkeletonBoneIndex(SkeletalMesh, SkeletonBoneIndex);
-		const FGLTFJsonNodeIndex NodeIndex = Builder.GetOrAddNode(RootNode, SkeletalMesh, BoneIndex);
-
-		if (Builder.ExportOptions->bRetargetBoneTransforms && Skeleton->GetBoneTranslationRetargetingMode(SkeletonBoneIndex) != EBoneTranslationRetargetingMode::Animation)
+		if (JointIndices.IsValidIndex(BoneIndex) && JointIndices[BoneIndex] == INDEX_NONE && Builder.FindNode(RootNode, SkeletalMesh, BoneIndex) == INDEX_NONE)
 		{
-			for (int32 Key = 0; Key < KeyTransforms.Num(); ++Key)
-			{
-				FGLTFBoneUtility::RetargetTransform(AnimSequence, KeyTransforms[Key], SkeletonBoneIndex, BoneIndex, BoneContainer);
-			}
+			// Bone has been stripped from the skin (since it neither deforms any vertex nor has any socket), and no skin of a follower
+			// component (using this mesh as leader pose) has added a node for it either
+			continue;
 		}
 
-		if (KeyPositions.Num() > 0)
-		{
-			TArray<FGLTFVector3> Translations;
-			Translations.AddUninitialized(KeyPositions.Num());
+		FGLTFTransformKeys& TransformKeys = Tracks.AddDefaulted_GetRef();
+		TransformKeys.NodeIndex = Builder.GetOrAddNode(RootNode, SkeletalMesh, BoneIndex);
+		TrackBones.Add({ TrackIndex, SkeletonBoneIndex, BoneIndex });
+	}
 
-			for (int32 Key = 0; Key < KeyPositions.Num(); ++Key)
-			{
-				const FVector KeyPosition = KeyTransforms[Key].GetTranslation();
-				Translations[Key] = FGLTFConverterUtility::ConvertPosition(KeyPosition, Builder.ExportOptions->ExportUniformScale);
-			}
+	const bool bRetargetBoneTransforms = Builder.ExportOptions->bRetargetBoneTransforms;
+	const bool bStep = Interpolation == EGLTFJsonInterpolation::Step;
+	const float ExportScale = Builder.ExportOptions->ExportUniformScale;
 
-			JsonInputAccessor.Count = Translations.Num();
-			JsonInputAccessor.Max[0] = Timestamps[Translations.Num() - 1];
-
-			FGLTFJsonAccessor JsonOutputAccessor;
-			JsonOutputAccessor.BufferView = Builder.AddBufferView(Translations);
-			JsonOutputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-			JsonOutputAccessor.Count = Translations.Num();
-			JsonOutputAccessor.Type = EGLTFJsonAccessorType::Vec3;
-
-			FGLTFJsonAnimationSampler JsonSampler;
-			JsonSampler.Input = Builder.AddAccessor(JsonInputAccessor);
-			JsonSampler.Output = Builder.AddAccessor(JsonOutputAccessor);
-			JsonSampler.Interpolation = Interpolation;
-
-			FGLTFJsonAnimationChannel JsonChannel;
-			JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
-			JsonChannel.Target.Path = EGLTFJsonTargetPath::Translation;
-			JsonChannel.Target.Node = NodeIndex;
-			JsonAnimation.Channels.Add(JsonChannel);
-		}
+	const auto LerpVector = [](const FVector& A, const FVector& B, float Alpha) { return FMath::Lerp(A, B, Alpha); };
+	const auto SlerpQuat = [](const FQuat& A, const FQuat& B, float Alpha) { return FQuat::Slerp(A, B, Alpha); };
+
+	ParallelFor(Tracks.Num(), [this, &Tracks, &TrackBones, &Timestamps, &BoneContainer, &LerpVector, &SlerpQuat, Skeleton, SequenceLength, bResample, bStep, bRetargetBoneTransforms, ExportScale](int32 Index)
+	{
+		const FTrackBone& TrackBone = TrackBones[Index];
+		const FRawAnimSequenceTrack& Track = AnimSequence->GetRawAnimationTrack(TrackBone.TrackIndex);
 
-		if (KeyRotations.Num() > 0)
+		// Resampling is done on the raw keys (before retargeting and conversion), so that neither has to be done for frames that won't be exported
+		TArray<FVector> KeyPositions = bResample ? ResampleKeys(Track.PosKeys, Timestamps, SequenceLength, bStep, LerpVector) : Track.PosKeys;
+		TArray<FQuat> KeyRotations = bResample ? ResampleKeys(Track.RotKeys, Timestamps, SequenceLength, bStep, SlerpQuat) : Track.RotKeys;
+		TArray<FVector> KeyScales = bResample ? ResampleKeys(Track.ScaleKeys, Timestamps, SequenceLength, bStep, LerpVector) : Track.ScaleKeys;
+
+		if (bRetargetBoneTransforms && Skeleton->GetBoneTranslationRetargetingMode(TrackBone.SkeletonBoneIndex) != EBoneTranslationRetargetingMode::Animation)
 		{
-			TArray<FGLTFQuaternion> Rotations;
-			Rotations.AddUninitialized(KeyRotations.Num());
+			const int32 MaxKeys = FMath::Max3(KeyPositions.Num(), KeyRotations.Num(), KeyScales.Num());
 
-			for (int32 Key = 0; Key < KeyRotations.Num(); ++Key)
+			for (int32 Key = 0; Key < MaxKeys; ++Key)
 			{
-				const FQuat KeyRotation = KeyTransforms[Key].GetRotation();
-				Rotations[Key] = FGLTFConverterUtility::ConvertRotation(KeyRotation);
-			}
+				const FVector& KeyPosition = KeyPositions.IsValidIndex(Key) ? KeyPositions[Key] : FVector::ZeroVector;
+				const FQuat& KeyRotation = KeyRotations.IsValidIndex(Key) ? KeyRotations[Key] : FQuat::Identity;
+				const FVector& KeyScale = KeyScales.IsValidIndex(Key) ? KeyScales[Key] : FVector::OneVector;
 
-			JsonInputAccessor.Count = Rotations.Num();
-			JsonInputAccessor.Max[0] = Timestamps[Rotations.Num() - 1];
-
-			FGLTFJsonAccessor JsonOutputAccessor;
-			JsonOutputAccessor.BufferView = Builder.AddBufferView(Rotations);
-			JsonOutputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-			JsonOutputAccessor.Count = Rotations.Num();
-			JsonOutputAccessor.Type = EGLTFJsonAccessorType::Vec4;
-
-			FGLTFJsonAnimationSampler JsonSampler;
-			JsonSampler.Input = Builder.AddAccessor(JsonInputAccessor);
-			JsonSampler.Output = Builder.AddAccessor(JsonOutputAccessor);
-			JsonSampler.Interpolation = Interpolation;
-
-			FGLTFJsonAnimationChannel JsonChannel;
-			JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
-			JsonChannel.Target.Path = EGLTFJsonTargetPath::Rotation;
-			JsonChannel.Target.Node = NodeIndex;
-			JsonAnimation.Channels.Add(JsonChannel);
-		}
+				FTransform KeyTransform(KeyRotation, KeyPosition, KeyScale);
+				FGLTFBoneUtility::RetargetTransform(AnimSequence, KeyTransform, TrackBone.SkeletonBoneIndex, TrackBone.BoneIndex, BoneContainer);
 
-		if (KeyScales.Num() > 0)
-		{
-			TArray<FGLTFVector3> Scales;
-			Scales.AddUninitialized(KeyScales.Num());
+				if (KeyPositions.IsValidIndex(Key))
+				{
+					KeyPositions[Key] = KeyTransform.GetTranslation();
+				}
 
-			for (int32 Key = 0; Key < KeyScales.Num(); ++Key)
-			{
-				const FVector KeyScale = KeyTransforms[Key].GetScale3D();
-				Scales[Key] = FGLTFConverterUtility::ConvertScale(KeyScale);
-			}
+				if (KeyRotations.IsValidIndex(Key))
+				{
+					KeyRotations[Key] = KeyTransform.GetRotation();
+				}
 
-			JsonInputAccessor.Count = Scales.Num();
-			JsonInputAccessor.Max[0] = Timestamps[Scales.Num() - 1];
-
-			FGLTFJsonAccessor JsonOutputAccessor;
-			JsonOutputAccessor.BufferView = Builder.AddBufferView(Scales);
-			JsonOutputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-			JsonOutputAccessor.Count = Scales.Num();
-			JsonOutputAccessor.Type = EGLTFJsonAccessorType::Vec3;
-
-			FGLTFJsonAnimationSampler JsonSampler;
-			JsonSampler.Input = Builder.AddAccessor(JsonInputAccessor);
-			JsonSampler.Output = Builder.AddAccessor(JsonOutputAccessor);
-			JsonSampler.Interpolation = Interpolation;
-
-			FGLTFJsonAnimationChannel JsonChannel;
-			JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
-			JsonChannel.Target.Path = EGLTFJsonTargetPath::Scale;
-			JsonChannel.Target.Node = NodeIndex;
-			JsonAnimation.Channels.Add(JsonChannel);
+				if (KeyScales.IsValidIndex(Key))
+				{
+					KeyScales[Key] = KeyTransform.GetScale3D();
+				}
+			}
 		}
-	}
+
+		FGLTFTransformKeys& TransformKeys = Tracks[Index];
+
+		TransformKeys.Translations.AddUninitialized(KeyPositions.Num());
+		FGLTFConverterUtility::ConvertPositions(KeyPositions, ExportScale, TransformKeys.Translations);
+
+		TransformKeys.Rotations.AddUninitialized(KeyRotations.Num());
+		FGLTFConverterUtility::ConvertRotations(KeyRotations, TransformKeys.Rotations);
+
+		TransformKeys.Scales.AddUninitialized(KeyScales.Num());
+		FGLTFConverterUtility::ConvertScales(KeyScales, TransformKeys.Scales);
+	});
+
+	AddChannels(Builder, JsonAnimation, Timestamps, Interpolation, Tracks);
 }
 
 void FGLTFLevelSequenceTask::Complete()
@@ -225,17 +457,11 @@ void FGLTFLevelSequenceTask::Complete()
 		FrameTimes[Frame] = FFrameRate::TransformTime(FFrameTime(FrameOffset + Frame), DisplayRate, TickResolution);
 	}
 
-	// TODO: add animation data accessor converters to reuse track information
+	const FFrameNumber StartFrame = FrameTimes[0].FloorToFrame();
+	const FFrameNumber EndFrame = FrameTimes.Last().CeilToFrame();
 
-	FGLTFJsonAccessor JsonInputAccessor;
-	JsonInputAccessor.BufferView = Builder.AddBufferView(Timestamps);
-	JsonInputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-	JsonInputAccessor.Type = EGLTFJsonAccessorType::Scalar;
-	JsonInputAccessor.Count = FrameCount;
-	JsonInputAccessor.MinMaxLength = 1;
-	JsonInputAccessor.Min[0] = 0;
-	JsonInputAccessor.Max[0] = DisplayRate.AsSeconds(FrameCount - 1);
-	FGLTFJsonAccessorIndex InputAccessorIndex = Builder.AddAccessor(JsonInputAccessor);
+	TArray<FGLTFTransformKeys> Tracks;
+	TArray<TArrayView<FMovieSceneFloatChannel*>> TrackChannels;
 
 	for (const FMovieSceneBinding& Binding : MovieScene->GetBindings())
 	{
@@ -295,117 +521,57 @@ void FGLTFLevelSequenceTask::Complete()
 					TArrayView<FMovieSceneFloatChannel*> Channels = TransformSection->GetChannelProxy().GetChannels<FMovieSceneFloatChannel>();
 					EMovieSceneTransformChannel ChannelMask = TransformSection->GetMask().GetChannels();
 
-					if (EnumHasAnyFlags(ChannelMask, EMovieSceneTransformChannel::Translation))
+					// Channels are only gathered here (on the game thread), and evaluated afterwards in parallel
+
+					FGLTFTransformKeys& TransformKeys = Tracks.AddDefaulted_GetRef();
+					TransformKeys.NodeIndex = NodeIndex;
+					TrackChannels.Add(Channels);
+
+					if (EnumHasAnyFlags(ChannelMask, EMovieSceneTransformChannel::Translation) &&
+						!AddCubicSplineChannel(Builder, JsonAnimation, NodeIndex, EGLTFJsonTargetPath::Translation, Channels.Slice(0, 3), StartFrame, EndFrame, TickResolution))
 					{
-						TArray<FGLTFVector3> Translations;
-						Translations.AddUninitialized(FrameCount);
-
-						for (int32 Frame = 0; Frame < FrameCount; ++Frame)
-						{
-							FFrameTime& FrameTime = FrameTimes[Frame];
-
-							FVector Translation = FVector::ZeroVector;
-							Channels[0]->Evaluate(FrameTime, Translation.X);
-							Channels[1]->Evaluate(FrameTime, Translation.Y);
-							Channels[2]->Evaluate(FrameTime, Translation.Z);
-
-							Translations[Frame] = FGLTFConverterUtility::ConvertPosition(Translation, Builder.ExportOptions->ExportUniformScale);
-						}
-
-						FGLTFJsonAccessor JsonOutputAccessor;
-						JsonOutputAccessor.BufferView = Builder.AddBufferView(Translations);
-						JsonOutputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-						JsonOutputAccessor.Count = Translations.Num();
-						JsonOutputAccessor.Type = EGLTFJsonAccessorType::Vec3;
-
-						FGLTFJsonAnimationSampler JsonSampler;
-						JsonSampler.Input = InputAccessorIndex;
-						JsonSampler.Output = Builder.AddAccessor(JsonOutputAccessor);
-						JsonSampler.Interpolation = EGLTFJsonInterpolation::Linear;
-
-						FGLTFJsonAnimationChannel JsonChannel;
-						JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
-						JsonChannel.Target.Path = EGLTFJsonTargetPath::Translation;
-						JsonChannel.Target.Node = NodeIndex;
-						JsonAnimation.Channels.Add(JsonChannel);
+						TransformKeys.Translations.AddUninitialized(FrameCount);
 					}
 
 					if (EnumHasAnyFlags(ChannelMask, EMovieSceneTransformChannel::Rotation))
 					{
-						TArray<FGLTFQuaternion> Rotations;
-						Rotations.AddUninitialized(FrameCount);
-
-						for (int32 Frame = 0; Frame < FrameCount; ++Frame)
-						{
-							FFrameTime& FrameTime = FrameTimes[Frame];
-
-							FRotator Rotator = FRotator::ZeroRotator;
-							Channels[3]->Evaluate(FrameTime, Rotator.Roll);
-							Channels[4]->Evaluate(FrameTime, Rotator.Pitch);
-							Channels[5]->Evaluate(FrameTime, Rotator.Yaw);
-
-							Rotations[Frame] = FGLTFConverterUtility::ConvertRotation(Rotator.Quaternion());
-						}
-
-						JsonInputAccessor.Count = Rotations.Num();
-						JsonInputAccessor.Max[0] = Timestamps[Rotations.Num() - 1];
-
-						FGLTFJsonAccessor JsonOutputAccessor;
-						JsonOutputAccessor.BufferView = Builder.AddBufferView(Rotations);
-						JsonOutputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-						JsonOutputAccessor.Count = Rotations.Num();
-						JsonOutputAccessor.Type = EGLTFJsonAccessorType::Vec4;
-
-						FGLTFJsonAnimationSampler JsonSampler;
-						JsonSampler.Input = InputAccessorIndex;
-						JsonSampler.Output = Builder.AddAccessor(JsonOutputAccessor);
-						JsonSampler.Interpolation = EGLTFJsonInterpolation::Linear;
-
-						FGLTFJsonAnimationChannel JsonChannel;
-						JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
-						JsonChannel.Target.Path = EGLTFJsonTargetPath::Rotation;
-						JsonChannel.Target.Node = NodeIndex;
-						JsonAnimation.Channels.Add(JsonChannel);
+						TransformKeys.Rotations.AddUninitialized(FrameCount);
 					}
 
-					if (EnumHasAnyFlags(ChannelMask, EMovieSceneTransformChannel::Scale))
+					if (EnumHasAnyFlags(ChannelMask, EMovieSceneTransformChannel::Scale) &&
+						!AddCubicSplineChannel(Builder, JsonAnimation, NodeIndex, EGLTFJsonTargetPath::Scale, Channels.Slice(6, 3), StartFrame, EndFrame, TickResolution))
 					{
-						TArray<FGLTFVector3> Scales;
-						Scales.AddUninitialized(FrameCount);
-
-						for (int32 Frame = 0; Frame < FrameCount; ++Frame)
-						{
-							FFrameTime& FrameTime = FrameTimes[Frame];
-
-							FVector Scale = FVector::OneVector;
-							Channels[6]->Evaluate(FrameTime, Scale.X);
-							Channels[7]->Evaluate(FrameTime, Scale.Y);
-							Channels[8]->Evaluate(FrameTime, Scale.Z);
-
-							Scales[Frame] = FGLTFConverterUtility::ConvertScale(Scale);
-						}
-
-						FGLTFJsonAccessor JsonOutputAccessor;
-						JsonOutputAccessor.BufferView = Builder.AddBufferView(Scales);
-						JsonOutputAccessor.ComponentType = EGLTFJsonComponentType::F32;
-						JsonOutputAccessor.Count = Scales.Num();
-						JsonOutputAccessor.Type = EGLTFJsonAccessorType::Vec3;
-
-						FGLTFJsonAnimationSampler JsonSampler;
-						JsonSampler.Input = InputAccessorIndex;
-						JsonSampler.Output = Builder.AddAccessor(JsonOutputAccessor);
-						JsonSampler.Interpolation = EGLTFJsonInterpolation::Linear;
-
-						FGLTFJsonAnimationChannel JsonChannel;
-						JsonChannel.Sampler = FGLTFJsonAnimationSamplerIndex(JsonAnimation.Samplers.Add(JsonSampler));
-						JsonChannel.Target.Path = EGLTFJsonTargetPath::Scale;
-						JsonChannel.Target.Node = NodeIndex;
-						JsonAnimation.Channels.Add(JsonChannel);
+						TransformKeys.Scales.AddUninitialized(FrameCount);
 					}
 				}
 			}
 		}
 	}
 
+	const float ExportScale = Builder.ExportOptions->ExportUniformScale;
+
+	ParallelFor(Tracks.Num(), [&Tracks, &TrackChannels, &FrameTimes, ExportScale](int32 TrackIndex)
+	{
+		FGLTFTransformKeys& TransformKeys = Tracks[TrackIndex];
+		const TArrayView<FMovieSceneFloatChannel*> Channels = TrackChannels[TrackIndex];
+
+		if (TransformKeys.Translations.Num() > 0)
+		{
+			EvaluateVectorChannels(Channels.Slice(0, 3), FrameTimes, 0, ExportScale, TransformKeys.Translations);
+		}
+
+		if (TransformKeys.Rotations.Num() > 0)
+		{
+			EvaluateRotationChannels(Channels.Slice(3, 3), FrameTimes, TransformKeys.Rotations);
+		}
+
+		if (TransformKeys.Scales.Num() > 0)
+		{
+			EvaluateVectorChannels(Channels.Slice(6, 3), FrameTimes, 1, 1, TransformKeys.Scales);
+		}
+	});
+
+	AddChannels(Builder, JsonAnimation, Timestamps, EGLTFJsonInterpolation::Linear, Tracks);
+
 	World->DestroyActor(LevelSequenceActor);
 }
@@ -61,8 +61,15 @@ void FGLTFMaterialTask::Complete()
 	JsonMaterial.AlphaCutoff = Material->GetOpacityMaskClipValue();
 	JsonMaterial.DoubleSided = Material->IsTwoSided();
 
-	ConvertAlphaMode(JsonMaterial.AlphaMode, JsonMaterial.BlendMode);
-	ConvertShadingModel(JsonMaterial.ShadingModel);
+	// NOTE: the modes are converted when collecting the properties to bake, which may already have happened as part of an earlier batch
+	CollectPropertyBakes();
+
+	// Bake all expected properties up front, in the same batch as the materials queued after this one
+	BakeQueue->BakeTask(this);
+
+	JsonMaterial.AlphaMode = JsonAlphaMode;
+	JsonMaterial.BlendMode = JsonBlendMode;
+	JsonMaterial.ShadingModel = JsonShadingModel;
 
 	if (JsonMaterial.ShadingModel != EGLTFJsonShadingModel::None)
 	{
@@ -73,16 +80,18 @@ void FGLTFMaterialTask::Complete()
 
 		if (JsonMaterial.AlphaMode == EGLTFJsonAlphaMode::Opaque)
 		{
-			if (!TryGetConstantColor(JsonMaterial.PBRMetallicRoughness.BaseColorFactor, BaseColorProperty))
+			const bool bIsBaseColorConstant = TryGetConstantColor(JsonMaterial.PBRMetallicRoughness.BaseColorFactor, BaseColorProperty);
+			if (NeedsBake(BaseColorProperty, DefaultColorInputMasks, bIsBaseColorConstant))
 			{
-				if (!TryGetSourceTexture(JsonMaterial.PBRMetallicRoughness.BaseColorTexture, BaseColorProperty, DefaultColorInputMasks))
+				if (!TryGetBakedMaterialProperty(JsonMaterial.PBRMetallicRoughness.BaseColorTexture, JsonMaterial.PBRMetallicRoughness.BaseColorFactor, BaseColorProperty, TEXT("BaseColor")))
 				{
-					if (!TryGetBakedMaterialProperty(JsonMaterial.PBRMetallicRoughness.BaseColorTexture, JsonMaterial.PBRMetallicRoughness.BaseColorFactor, BaseColorProperty, TEXT("BaseColor")))
-					{
-						Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *BaseColorProperty.ToString(), *Material->GetName()));
-					}
+					Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *BaseColorProperty.ToString(), *Material->GetName()));
 				}
 			}
+			else if (!bIsBaseColorConstant)
+			{
+				TryGetSourceTexture(JsonMaterial.PBRMetallicRoughness.BaseColorTexture, BaseColorProperty, DefaultColorInputMasks);
+			}
 
 			JsonMaterial.PBRMetallicRoughness.BaseColorFactor.A = 1.0f; // make sure base color is opaque
 		}
@@ -111,28 +120,32 @@ void FGLTFMaterialTask::Complete()
 			}
 
 			const FMaterialPropertyEx NormalProperty = JsonMaterial.ShadingModel == EGLTFJsonShadingModel::ClearCoat ? FMaterialPropertyEx(TEXT("ClearCoatBottomNormal")) : FMaterialPropertyEx(MP_Normal);
-			if (IsPropertyNonDefault(NormalProperty))
+			const bool bIsNormalDefault = !IsPropertyNonDefault(NormalProperty);
+			if (NeedsBake(NormalProperty, DefaultColorInputMasks, bIsNormalDefault))
 			{
-				if (!TryGetSourceTexture(JsonMaterial.NormalTexture, NormalProperty, DefaultColorInputMasks))
+				if (!TryGetBakedMaterialProperty(JsonMaterial.NormalTexture, NormalProperty, TEXT("Normal")))
 				{
-					if (!TryGetBakedMaterialProperty(JsonMaterial.NormalTexture, NormalProperty, TEXT("Normal")))
-					{
-						Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *NormalProperty.ToString(), *Material->GetName()));
-					}
+					Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *NormalProperty.ToString(), *Material->GetName()));
 				}
 			}
+			else if (!bIsNormalDefault)
+			{
+				TryGetSourceTexture(JsonMaterial.NormalTexture, NormalProperty, DefaultColorInputMasks);
+			}
 
 			const FMaterialPropertyEx AmbientOcclusionProperty = MP_AmbientOcclusion;
-			if (IsPropertyNonDefault(AmbientOcclusionProperty))
+			const bool bIsAmbientOcclusionDefault = !IsPropertyNonDefault(AmbientOcclusionProperty);
+			if (NeedsBake(AmbientOcclusionProperty, OcclusionInputMasks, bIsAmbientOcclusionDefault))
 			{
-				if (!TryGetSourceTexture(JsonMaterial.OcclusionTexture, AmbientOcclusionProperty, OcclusionInputMasks))
+				if (!TryGetBakedMaterialProperty(JsonMaterial.OcclusionTexture, AmbientOcclusionProperty, TEXT("Occlusion"), true))
 				{
-					if (!TryGetBakedMaterialProperty(JsonMaterial.OcclusionTexture, AmbientOcclusionProperty, TEXT("Occlusion"), true))
-					{
-						Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *AmbientOcclusionProperty.ToString(), *Material->GetName()));
-					}
+					Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *AmbientOcclusionProperty.ToString(), *Material->GetName()));
 				}
 			}
+			else if (!bIsAmbientOcclusionDefault)
+			{
+				TryGetSourceTexture(JsonMaterial.OcclusionTexture, AmbientOcclusionProperty, OcclusionInputMasks);
+			}
 
 			if (JsonMaterial.ShadingModel == EGLTFJsonShadingModel::ClearCoat)
 			{
@@ -145,16 +158,18 @@ void FGLTFMaterialTask::Complete()
 				}
 
 				const FMaterialPropertyEx ClearCoatNormalProperty = MP_Normal;
-				if (IsPropertyNonDefault(ClearCoatNormalProperty))
+				const bool bIsClearCoatNormalDefault = !IsPropertyNonDefault(ClearCoatNormalProperty);
+				if (NeedsBake(ClearCoatNormalProperty, DefaultColorInputMasks, bIsClearCoatNormalDefault))
 				{
-					if (!TryGetSourceTexture(JsonMaterial.ClearCoat.ClearCoatNormalTexture, ClearCoatNormalProperty, DefaultColorInputMasks))
+					if (!TryGetBakedMaterialProperty(JsonMaterial.ClearCoat.ClearCoatNormalTexture, ClearCoatNormalProperty, TEXT("ClearCoatNormal")))
 					{
-						if (!TryGetBakedMaterialProperty(JsonMaterial.ClearCoat.ClearCoatNormalTexture, ClearCoatNormalProperty, TEXT("ClearCoatNormal")))
-						{
-							Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *ClearCoatNormalProperty.ToString(), *Material->GetName()));
-						}
+						Builder.AddWarningMessage(FString::Printf(TEXT("Failed to export %s for material %s"), *ClearCoatNormalProperty.ToString(), *Material->GetName()));
 					}
 				}
+				else if (!bIsClearCoatNormalDefault)
+				{
+					TryGetSourceTexture(JsonMaterial.ClearCoat.ClearCoatNormalTexture, ClearCoatNormalProperty, DefaultColorInputMasks);
+				}
 			}
 		}
 	}
@@ -184,6 +199,19 @@ void FGLTFMaterialTask::Complete()
 	}
 }
 
+void FGLTFMaterialTask::GetPendingPropertyBakes(TArray<FGLTFPropertyBake*>& OutPropertyBakes)
+{
+	CollectPropertyBakes();
+
+	for (FGLTFPropertyBake& PropertyBake : PropertyBakes)
+	{
+		if (!PropertyBake.Output.IsSet())
+		{
+			OutPropertyBakes.Add(&PropertyBake);
+		}
+	}
+}
+
 void FGLTFMaterialTask::ConvertAlphaMode(EGLTFJsonAlphaMode& OutAlphaMode, EGLTFJsonBlendMode& OutBlendMode) const
 {
 	const EBlendMode BlendMode = Material->GetBlendMode();
@@ -291,6 +319,168 @@ void FGLTFMaterialTask::ConvertShadingModel(EGLTFJsonShadingModel& OutShadingMod
 	}
 }
 
+void FGLTFMaterialTask::CollectPropertyBakes()
+{
+	if (bHasPropertyBakes)
+	{
+		return;
+	}
+
+	bHasPropertyBakes = true;
+
+	ConvertAlphaMode(JsonAlphaMode, JsonBlendMode);
+	ConvertShadingModel(JsonShadingModel);
+
+	if (JsonShadingModel == EGLTFJsonShadingModel::None || Builder.ExportOptions->BakeMaterialInputs == EGLTFMaterialBakeMode::Disabled)
+	{
+		return;
+	}
+
+	// NOTE: the decisions are shared with completing the task (via NeedsBake and NeedsCombinedBake), but made here without adding any textures.
+	// A property that ends up baked without being collected here is simply baked on its own.
+
+	FLinearColor ConstantColor;
+	float ConstantScalar;
+
+	const FMaterialPropertyEx BaseColorProperty = JsonShadingModel == EGLTFJsonShadingModel::Unlit ? MP_EmissiveColor : MP_BaseColor;
+	const FMaterialPropertyEx OpacityProperty = JsonAlphaMode == EGLTFJsonAlphaMode::Mask ? MP_OpacityMask : MP_Opacity;
+
+	if (JsonAlphaMode == EGLTFJsonAlphaMode::Opaque)
+	{
+		if (NeedsBake(BaseColorProperty, DefaultColorInputMasks, TryGetConstantColor(ConstantColor, BaseColorProperty)))
+		{
+			AddPropertyBake(BaseColorProperty, Builder.GetBakeSizeForMaterialProperty(Material, BaseColorProperty));
+		}
+	}
+	else
+	{
+		const bool bIsBaseColorConstant = TryGetConstantColor(ConstantColor, BaseColorProperty);
+		const bool bIsOpacityConstant = TryGetConstantScalar(ConstantScalar, OpacityProperty);
+
+		if (NeedsCombinedBake(BaseColorProperty, BaseColorInputMasks, bIsBaseColorConstant, OpacityProperty, OpacityInputMasks, bIsOpacityConstant))
+		{
+			const FIntPoint TextureSize = Builder.GetBakeSizeForMaterialProperty(Material, BaseColorProperty);
+			AddPropertyBake(BaseColorProperty, TextureSize);
+			AddPropertyBake(OpacityProperty, TextureSize, true);
+		}
+	}
+
+	if (JsonShadingModel == EGLTFJsonShadingModel::Default || JsonShadingModel == EGLTFJsonShadingModel::ClearCoat)
+	{
+		const FMaterialPropertyEx MetallicProperty = MP_Metallic;
+		const FMaterialPropertyEx RoughnessProperty = MP_Roughness;
+
+		const bool bIsMetallicConstant = TryGetConstantScalar(ConstantScalar, MetallicProperty);
+		const bool bIsRoughnessConstant = TryGetConstantScalar(ConstantScalar, RoughnessProperty);
+
+		if (NeedsCombinedBake(MetallicProperty, MetallicInputMasks, bIsMetallicConstant, RoughnessProperty, RoughnessInputMasks, bIsRoughnessConstant))
+		{
+			const FIntPoint TextureSize = Builder.GetBakeSizeForMaterialProperty(Material, MetallicProperty);
+			AddPropertyBake(MetallicProperty, TextureSize);
+			AddPropertyBake(RoughnessProperty, TextureSize);
+		}
+
+		const FMaterialPropertyEx EmissiveProperty = MP_EmissiveColor;
+		if (NeedsBake(EmissiveProperty, DefaultColorInputMasks, TryGetConstantColor(ConstantColor, EmissiveProperty)))
+		{
+			AddPropertyBake(EmissiveProperty, Builder.GetBakeSizeForMaterialProperty(Material, EmissiveProperty));
+		}
+
+		const FMaterialPropertyEx NormalProperty = JsonShadingModel == EGLTFJsonShadingModel::ClearCoat ? FMaterialPropertyEx(TEXT("ClearCoatBottomNormal")) : FMaterialPropertyEx(MP_Normal);
+		if (NeedsBake(NormalProperty, DefaultColorInputMasks, !IsPropertyNonDefault(NormalProperty)))
+		{
+			AddPropertyBake(NormalProperty, Builder.GetBakeSizeForMaterialProperty(Material, NormalProperty));
+		}
+
+		const FMaterialPropertyEx AmbientOcclusionProperty = MP_AmbientOcclusion;
+		if (NeedsBake(AmbientOcclusionProperty, OcclusionInputMasks, !IsPropertyNonDefault(AmbientOcclusionProperty)))
+		{
+			AddPropertyBake(AmbientOcclusionProperty, Builder.GetBakeSizeForMaterialProperty(Material, AmbientOcclusionProperty));
+		}
+
+		if (JsonShadingModel == EGLTFJsonShadingModel::ClearCoat)
+		{
+			const FMaterialPropertyEx ClearCoatProperty = MP_CustomData0;
+			const FMaterialPropertyEx ClearCoatRoughnessProperty = MP_CustomData1;
+
+			const bool bIsIntensityConstant = TryGetConstantScalar(ConstantScalar, ClearCoatProperty);
+			const bool bIsRoughnessConstant = TryGetConstantScalar(ConstantScalar, ClearCoatRoughnessProperty);
+
+			if (NeedsCombinedBake(ClearCoatProperty, ClearCoatInputMasks, bIsIntensityConstant, ClearCoatRoughnessProperty, ClearCoatRoughnessInputMasks, bIsRoughnessConstant))
+			{
+				const FIntPoint TextureSize = Builder.GetBakeSizeForMaterialProperty(Material, ClearCoatProperty);
+				AddPropertyBake(ClearCoatProperty, TextureSize);
+				AddPropertyBake(ClearCoatRoughnessProperty, TextureSize);
+			}
+
+			const FMaterialPropertyEx ClearCoatNormalProperty = MP_Normal;
+			if (NeedsBake(ClearCoatNormalProperty, DefaultColorInputMasks, !IsPropertyNonDefault(ClearCoatNormalProperty)))
+			{
+				AddPropertyBake(ClearCoatNormalProperty, Builder.GetBakeSizeForMaterialProperty(Material, ClearCoatNormalProperty));
+			}
+		}
+	}
+}
+
+void FGLTFMaterialTask::AddPropertyBake(const FMaterialPropertyEx& Property, const FIntPoint& TextureSize, bool bCopyAlphaFromRedChannel)
+{
+	const FMeshDescription* MeshDescription = MeshData != nullptr ? &MeshData->Description : nullptr;
+	PropertyBakes.Emplace(FGLTFPropertyBakeInput(Property, TextureSize, Material, GetBakeTexCoord(Property), MeshDescription, SectionIndices, bCopyAlphaFromRedChannel));
+}
+
+bool FGLTFMaterialTask::NeedsBake(const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks, bool bIsConstant) const
+{
+	return !bIsConstant && !HasSourceTexture(Property, AllowedMasks);
+}
+
+bool FGLTFMaterialTask::NeedsCombinedBake(const FMaterialPropertyEx& PropertyA, const TArray<FLinearColor>& AllowedMasksA, bool bIsConstantA, const FMaterialPropertyEx& PropertyB, const TArray<FLinearColor>& AllowedMasksB, bool bIsConstantB) const
+{
+	return !(bIsConstantA && bIsConstantB) && !HasCombinedSourceTexture(PropertyA, AllowedMasksA, PropertyB, AllowedMasksB);
+}
+
+bool FGLTFMaterialTask::HasSourceTexture(const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks) const
+{
+	const UTexture2D* Texture;
+	int32 TexCoord;
+	FGLTFJsonTextureTransform Transform;
+
+	return FindSourceTexture(Texture, TexCoord, Transform, Property, AllowedMasks);
+}
+
+bool FGLTFMaterialTask::HasCombinedSourceTexture(const FMaterialPropertyEx& PropertyA, const TArray<FLinearColor>& AllowedMasksA, const FMaterialPropertyEx& PropertyB, const TArray<FLinearColor>& AllowedMasksB) const
+{
+	const UTexture2D* TextureA;
+	const UTexture2D* TextureB;
+	int32 TexCoordA;
+	int32 TexCoordB;
+	FGLTFJsonTextureTransform TransformA;
+	FGLTFJsonTextureTransform TransformB;
+
+	if (!FindSourceTexture(TextureA, TexCoordA, TransformA, PropertyA, AllowedMasksA) ||
+		!FindSourceTexture(TextureB, TexCoordB, TransformB, PropertyB, AllowedMasksB))
+	{
+		return false;
+	}
+
+	// NOTE: transforms are reset (and thereby equal) when texture transforms are disabled by export options
+	return TextureA == TextureB &&
+		TexCoordA == TexCoordB &&
+		(!Builder.ExportOptions->bExportTextureTransforms || TransformA.IsExactlyEqual(TransformB));
+}
+
+int32 FGLTFMaterialTask::GetBakeTexCoord(const FMaterialPropertyEx& Property) const
+{
+	if (MeshData != nullptr)
+	{
+		return MeshData->TexCoord;
+	}
+
+	FGLTFIndexArray TexCoords;
+	FGLTFMaterialUtility::GetAllTextureCoordinateIndices(Material, Property, TexCoords);
+
+	return TexCoords.Num() > 0 ? TexCoords[0] : 0;
+}
+
 bool FGLTFMaterialTask::TryGetBaseColorAndOpacity(FGLTFJsonPBRMetallicRoughness& OutPBRParams, const FMaterialPropertyEx& BaseColorProperty, const FMaterialPropertyEx& OpacityProperty)
 {
 	const bool bIsBaseColorConstant = TryGetConstantColor(OutPBRParams.BaseColorFactor, BaseColorProperty);
@@ -313,15 +503,9 @@ bool FGLTFMaterialTask::TryGetBaseColorAndOpacity(FGLTFJsonPBRMetallicRoughness&
 	FGLTFJsonTextureTransform BaseColorTransform;
 	FGLTFJsonTextureTransform OpacityTransform;
 
-	const bool bHasBaseColorSourceTexture = TryGetSourceTexture(BaseColorTexture, BaseColorTexCoord, BaseColorTransform, BaseColorProperty, BaseColorInputMasks);
-	const bool bHasOpacitySourceTexture = TryGetSourceTexture(OpacityTexture, OpacityTexCoord, OpacityTransform, OpacityProperty, OpacityInputMasks);
-
 	// Detect the "happy path" where both inputs share the same texture and are correctly masked.
-	if (bHasBaseColorSourceTexture &&
-		bHasOpacitySourceTexture &&
-		BaseColorTexture == OpacityTexture &&
-		BaseColorTexCoord == OpacityTexCoord &&
-		BaseColorTransform.IsExactlyEqual(OpacityTransform))
+	if (!NeedsCombinedBake(BaseColorProperty, BaseColorInputMasks, bIsBaseColorConstant, OpacityProperty, OpacityInputMasks, bIsOpacityConstant) &&
+		TryGetSourceTexture(BaseColorTexture, BaseColorTexCoord, BaseColorTransform, BaseColorProperty, BaseColorInputMasks))
 	{
 		OutPBRParams.BaseColorTexture.Index = Builder.GetOrAddTexture(BaseColorTexture);
 		OutPBRParams.BaseColorTexture.TexCoord = BaseColorTexCoord;
@@ -438,15 +622,9 @@ bool FGLTFMaterialTask::TryGetMetallicAndRoughness(FGLTFJsonPBRMetallicRoughness
 	FGLTFJsonTextureTransform MetallicTransform;
 	FGLTFJsonTextureTransform RoughnessTransform;
 
-	const bool bHasMetallicSourceTexture = TryGetSourceTexture(MetallicTexture, MetallicTexCoord, MetallicTransform, MetallicProperty, MetallicInputMasks);
-	const bool bHasRoughnessSourceTexture = TryGetSourceTexture(RoughnessTexture, RoughnessTexCoord, RoughnessTransform, RoughnessProperty, RoughnessInputMasks);
-
 	// Detect the "happy path" where both inputs share the same texture and are correctly masked.
-	if (bHasMetallicSourceTexture &&
-		bHasRoughnessSourceTexture &&
-		MetallicTexture == RoughnessTexture &&
-		MetallicTexCoord == RoughnessTexCoord &&
-		MetallicTransform.IsExactlyEqual(RoughnessTransform))
+	if (!NeedsCombinedBake(MetallicProperty, MetallicInputMasks, bIsMetallicConstant, RoughnessProperty, RoughnessInputMasks, bIsRoughnessConstant) &&
+		TryGetSourceTexture(MetallicTexture, MetallicTexCoord, MetallicTransform, MetallicProperty, MetallicInputMasks))
 	{
 		OutPBRParams.MetallicRoughnessTexture.Index = Builder.GetOrAddTexture(MetallicTexture);
 		OutPBRParams.MetallicRoughnessTexture.TexCoord = MetallicTexCoord;
@@ -563,15 +741,9 @@ bool FGLTFMaterialTask::TryGetClearCoatRoughness(FGLTFJsonClearCoatExtension& Ou
 	FGLTFJsonTextureTransform IntensityTransform;
 	FGLTFJsonTextureTransform RoughnessTransform;
 
-	const bool bHasIntensitySourceTexture = TryGetSourceTexture(IntensityTexture, IntensityTexCoord, IntensityTransform, IntensityProperty, ClearCoatInputMasks);
-	const bool bHasRoughnessSourceTexture = TryGetSourceTexture(RoughnessTexture, RoughnessTexCoord, RoughnessTransform, RoughnessProperty, ClearCoatRoughnessInputMasks);
-
 	// Detect the "happy path" where both inputs share the same texture and are correctly masked.
-	if (bHasIntensitySourceTexture &&
-		bHasRoughnessSourceTexture &&
-		IntensityTexture == RoughnessTexture &&
-		IntensityTexCoord == RoughnessTexCoord &&
-		IntensityTransform.IsExactlyEqual(RoughnessTransform))
+	if (!NeedsCombinedBake(IntensityProperty, ClearCoatInputMasks, bIsIntensityConstant, RoughnessProperty, ClearCoatRoughnessInputMasks, bIsRoughnessConstant) &&
+		TryGetSourceTexture(IntensityTexture, IntensityTexCoord, IntensityTransform, IntensityProperty, ClearCoatInputMasks))
 	{
 		const FGLTFJsonTextureIndex TextureIndex = Builder.GetOrAddTexture(IntensityTexture);
 		OutExtParams.ClearCoatTexture.Index = TextureIndex;
@@ -671,14 +843,15 @@ bool FGLTFMaterialTask::TryGetEmissive(FGLTFJsonMaterial& JsonMaterial, const FM
 	// TODO: right now we allow EmissiveFactor to be > 1.0 to support very bright emission, although it's not valid according to the glTF standard.
 	// We may want to change this behaviour and store factors above 1.0 using a custom extension instead.
 
-	if (TryGetConstantColor(JsonMaterial.EmissiveFactor, MP_EmissiveColor))
+	const bool bIsEmissiveConstant = TryGetConstantColor(JsonMaterial.EmissiveFactor, MP_EmissiveColor);
+	if (!NeedsBake(EmissiveProperty, DefaultColorInputMasks, bIsEmissiveConstant))
 	{
-		return true;
-	}
+		if (!bIsEmissiveConstant)
+		{
+			TryGetSourceTexture(JsonMaterial.EmissiveTexture, EmissiveProperty, DefaultColorInputMasks);
+			JsonMaterial.EmissiveFactor = FGLTFJsonColor3::White;	// make sure texture is not multiplied with black
+		}
 
-	if (TryGetSourceTexture(JsonMaterial.EmissiveTexture, EmissiveProperty, DefaultColorInputMasks))
-	{
-		JsonMaterial.EmissiveFactor = FGLTFJsonColor3::White;	// make sure texture is not multiplied with black
 		return true;
 	}
 
@@ -993,6 +1166,26 @@ bool FGLTFMaterialTask::TryGetSourceTexture(FGLTFJsonTextureInfo& OutTexInfo, co
 }
 
 bool FGLTFMaterialTask::TryGetSourceTexture(const UTexture2D*& OutTexture, int32& OutTexCoord, FGLTFJsonTextureTransform& OutTransform, const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks) const
+{
+	if (!FindSourceTexture(OutTexture, OutTexCoord, OutTransform, Property, AllowedMasks))
+	{
+		return false;
+	}
+
+	if (!Builder.ExportOptions->bExportTextureTransforms && !OutTransform.IsExactlyDefault())
+	{
+		Builder.AddWarningMessage(FString::Printf(
+			TEXT("Texture coordinates [%d] in %s for material %s are transformed, but texture transform is disabled by export options"),
+			OutTexCoord,
+			*Property.ToString(),
+			*Material->GetName()));
+		OutTransform = {};
+	}
+
+	return true;
+}
+
+bool FGLTFMaterialTask::FindSourceTexture(const UTexture2D*& OutTexture, int32& OutTexCoord, FGLTFJsonTextureTransform& OutTransform, const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks) const
 {
 	if (Builder.ExportOptions->TextureImageFormat == EGLTFTextureImageFormat::None)
 	{
@@ -1055,16 +1248,6 @@ bool FGLTFMaterialTask::TryGetSourceTexture(const UTexture2D*& OutTexture, int32
 			return false;
 		}
 
-		if (!Builder.ExportOptions->bExportTextureTransforms && !OutTransform.IsExactlyDefault())
-		{
-			Builder.AddWarningMessage(FString::Printf(
-				TEXT("Texture coordinates [%d] in %s for material %s are transformed, but texture transform is disabled by export options"),
-				OutTexCoord,
-				*Property.ToString(),
-				*Material->GetName()));
-			OutTransform = {};
-		}
-
 		return true;
 	}
 
@@ -1092,16 +1275,6 @@ bool FGLTFMaterialTask::TryGetSourceTexture(const UTexture2D*& OutTexture, int32
 			return false;
 		}
 
-		if (!Builder.ExportOptions->bExportTextureTransforms && !OutTransform.IsExactlyDefault())
-		{
-			Builder.AddWarningMessage(FString::Printf(
-				TEXT("Texture coordinates [%d] in %s for material %s are transformed, but texture transform is disabled by export options"),
-				OutTexCoord,
-				*Property.ToString(),
-				*Material->GetName()));
-			OutTransform = {};
-		}
-
 		return true;
 	}
 
@@ -1330,6 +1503,18 @@ FGLTFPropertyBakeOutput FGLTFMaterialTask::BakeMaterialProperty(const FMaterialP
 		MeshDataBakedProperties.Add(Property);
 	}
 
+	// Use the output baked ahead of time (together with other materials) if the property was expected
+	const FGLTFPropertyBakeInput BakeInput(Property, TextureSize, Material, OutTexCoord, MeshData != nullptr ? &MeshData->Description : nullptr, SectionIndices, bCopyAlphaFromRedChannel);
+	for (FGLTFPropertyBake& PropertyBake : PropertyBakes)
+	{
+		if (PropertyBake.Output.IsSet() && PropertyBake.Input == BakeInput)
+		{
+			FGLTFPropertyBakeOutput PropertyBakeOutput = MoveTemp(PropertyBake.Output.GetValue());
+			PropertyBake.Output.Reset();
+			return PropertyBakeOutput;
+		}
+	}
+
 	// TODO: add support for calculating the ideal resolution to use for baking based on connected (texture) nodes
 
 	const FGLTFPropertyBakeOutput PropertyBakeOutput = FGLTFMaterialUtility::BakeMaterialProperty(
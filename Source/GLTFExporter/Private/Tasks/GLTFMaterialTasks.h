@@ -6,24 +6,35 @@
 #include "Builders/GLTFConvertBuilder.h"
 #include "Converters/GLTFUVOverlapChecker.h"
 #include "Converters/GLTFMeshData.h"
+#include "Converters/GLTFMaterialUtility.h"
+#include "Converters/GLTFMaterialBakeQueue.h"
 #include "MaterialPropertyEx.h"
 #include "Engine.h"
 
-struct FGLTFPropertyBakeOutput;
-
 class FGLTFMaterialTask : public FGLTFTask
 {
 public:
 
-	FGLTFMaterialTask(FGLTFConvertBuilder& Builder, FGLTFUVOverlapChecker& UVOverlapChecker, const UMaterialInterface* Material, const FGLTFMeshData* MeshData, FGLTFIndexArray SectionIndices, FGLTFJsonMaterialIndex MaterialIndex)
+	FGLTFMaterialTask(FGLTFConvertBuilder& Builder, FGLTFUVOverlapChecker& UVOverlapChecker, const TSharedRef<FGLTFMaterialBakeQueue>& BakeQueue, const UMaterialInterface* Material, const FGLTFMeshData* MeshData, FGLTFIndexArray SectionIndices, FGLTFJsonMaterialIndex MaterialIndex)
 		: FGLTFTask(EGLTFTaskPriority::Material)
 		, Builder(Builder)
 		, UVOverlapChecker(UVOverlapChecker)
+		, BakeQueue(BakeQueue)
 		, Material(Material)
 		, MeshData(MeshData)
 		, SectionIndices(SectionIndices)
 		, MaterialIndex(MaterialIndex)
+		, JsonAlphaMode(EGLTFJsonAlphaMode::None)
+		, JsonBlendMode(EGLTFJsonBlendMode::None)
+		, JsonShadingModel(EGLTFJsonShadingModel::None)
+		, bHasPropertyBakes(false)
+	{
+		BakeQueue->AddTask(this);
+	}
+
+	virtual ~FGLTFMaterialTask() override
 	{
+		BakeQueue->RemoveTask(this);
 	}
 
 	virtual FString GetName() override
@@ -33,20 +44,39 @@ public:
 
 	virtual void Complete() override;
 
+	// Adds the properties that are expected to be baked when completing the task (and haven't been yet), so they can be baked ahead of time together with other materials
+	void GetPendingPropertyBakes(TArray<FGLTFPropertyBake*>& OutPropertyBakes);
+
 private:
 
 	FGLTFConvertBuilder& Builder;
 	FGLTFUVOverlapChecker& UVOverlapChecker;
+	const TSharedRef<FGLTFMaterialBakeQueue> BakeQueue;
 	const UMaterialInterface* Material;
 	const FGLTFMeshData* MeshData;
 	const FGLTFIndexArray SectionIndices;
 	const FGLTFJsonMaterialIndex MaterialIndex;
 
+	EGLTFJsonAlphaMode JsonAlphaMode;
+	EGLTFJsonBlendMode JsonBlendMode;
+	EGLTFJsonShadingModel JsonShadingModel;
+
+	bool bHasPropertyBakes;
+	TArray<FGLTFPropertyBake> PropertyBakes;
+
 	TSet<FMaterialPropertyEx> MeshDataBakedProperties;
 
 	void ConvertAlphaMode(EGLTFJsonAlphaMode& OutAlphaMode, EGLTFJsonBlendMode& OutBlendMode) const;
 	void ConvertShadingModel(EGLTFJsonShadingModel& OutShadingModel) const;
 
+	void CollectPropertyBakes();
+	void AddPropertyBake(const FMaterialPropertyEx& Property, const FIntPoint& TextureSize, bool bCopyAlphaFromRedChannel = false);
+	bool NeedsBake(const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks, bool bIsConstant) const;
+	bool NeedsCombinedBake(const FMaterialPropertyEx& PropertyA, const TArray<FLinearColor>& AllowedMasksA, bool bIsConstantA, const FMaterialPropertyEx& PropertyB, const TArray<FLinearColor>& AllowedMasksB, bool bIsConstantB) const;
+	bool HasSourceTexture(const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks) const;
+	bool HasCombinedSourceTexture(const FMaterialPropertyEx& PropertyA, const TArray<FLinearColor>& AllowedMasksA, const FMaterialPropertyEx& PropertyB, const TArray<FLinearColor>& AllowedMasksB) const;
+	int32 GetBakeTexCoord(const FMaterialPropertyEx& Property) const;
+
 	bool TryGetBaseColorAndOpacity(FGLTFJsonPBRMetallicRoughness& OutPBRParams, const FMaterialPropertyEx& BaseColorProperty, const FMaterialPropertyEx& OpacityProperty);
 	bool TryGetMetallicAndRoughness(FGLTFJsonPBRMetallicRoughness& OutPBRParams, const FMaterialPropertyEx& MetallicProperty, const FMaterialPropertyEx& RoughnessProperty);
 	bool TryGetClearCoatRoughness(FGLTFJsonClearCoatExtension& OutExtParams, const FMaterialPropertyEx& IntensityProperty, const FMaterialPropertyEx& RoughnessProperty);
@@ -60,6 +90,7 @@ private:
 
 	bool TryGetSourceTexture(FGLTFJsonTextureInfo& OutTexInfo, const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks = {}) const;
 	bool TryGetSourceTexture(const UTexture2D*& OutTexture, int32& OutTexCoord, FGLTFJsonTextureTransform& OutTransform, const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks = {}) const;
+	bool FindSourceTexture(const UTexture2D*& OutTexture, int32& OutTexCoord, FGLTFJsonTextureTransform& OutTransform, const FMaterialPropertyEx& Property, const TArray<FLinearColor>& AllowedMasks) const;
 
 	bool TryGetBakedMaterialProperty(FGLTFJsonTextureInfo& OutTexInfo, FGLTFJsonColor3& OutConstant, const FMaterialPropertyEx& Property, const FString& PropertyName, bool bTransformToLinear = false);
 	bool TryGetBakedMaterialProperty(FGLTFJsonTextureInfo& OutTexInfo, FGLTFJsonColor4& OutConstant, const FMaterialPropertyEx& Property, const FString& PropertyName, bool bTransformToLinear = false);
@@ -3,37 +3,14 @@
 #include "Tasks/GLTFMeshTasks.h"
 #include "Converters/GLTFConverterUtility.h"
 #include "Converters/GLTFMeshUtility.h"
+#include "Converters/GLTFMaterialUtility.h"
+#include "Converters/GLTFJointPaletteUtility.h"
 #include "Builders/GLTFConvertBuilder.h"
 #include "Rendering/SkeletalMeshRenderData.h"
+#include "Animation/MorphTarget.h"
 
 namespace
 {
-	template <typename TangentVectorType>
-	void CheckTangentVectors(const FStaticMeshVertexBuffer* VertexBuffer, bool& bOutZeroNormals, bool& bOutZeroTangents)
-	{
-		bool bZeroNormals = false;
-		bool bZeroTangents = false;
-
-		typedef TStaticMeshVertexTangentDatum<TangentVectorType> VertexTangentType;
-
-		const void* TangentData = const_cast<FStaticMeshVertexBuffer*>(VertexBuffer)->GetTangentData();
-		const VertexTangentType* VertexTangents = TangentData != nullptr ? static_cast<const VertexTangentType*>(TangentData) : nullptr;
-
-		if (VertexTangents != nullptr)
-		{
-			const uint32 VertexCount = VertexBuffer->GetNumVertices();
-			for (uint32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
-			{
-				const VertexTangentType& VertexTangent = VertexTangents[VertexIndex];
-				bZeroNormals |= VertexTangent.TangentZ.ToFVector().IsNearlyZero();
-				bZeroTangents |= VertexTangent.TangentX.ToFVector().IsNearlyZero();
-			}
-		}
-
-		bOutZeroNormals = bZeroNormals;
-		bOutZeroTangents = bZeroTangents;
-	}
-
 	void ValidateVertexBuffer(FGLTFConvertBuilder& Builder, const FStaticMeshVertexBuffer* VertexBuffer, const TCHAR* MeshName)
 	{
 		if (VertexBuffer == nullptr)
@@ -41,26 +18,16 @@ namespace
 			return;
 		}
 
-		bool bZeroNormals;
-		bool bZeroTangents;
+		const FGLTFTangentBufferAnalysis Analysis = Builder.TangentBufferAnalysisConverter.GetOrAdd(VertexBuffer);
 
-		if (VertexBuffer->GetUseHighPrecisionTangentBasis())
-		{
-			CheckTangentVectors<FPackedRGBA16N>(VertexBuffer, bZeroNormals, bZeroTangents);
-		}
-		else
-		{
-			CheckTangentVectors<FPackedNormal>(VertexBuffer, bZeroNormals, bZeroTangents);
-		}
-
-		if (bZeroNormals)
+		if (Analysis.bHasZeroNormals)
 		{
 			Builder.AddWarningMessage(FString::Printf(
 				TEXT("Mesh %s has some nearly zero-length normals which can create some issues. Consider checking 'Recompute Normals' in the asset settings"),
 				MeshName));
 		}
 
-		if (bZeroTangents)
+		if (Analysis.bHasZeroTangents)
 		{
 			Builder.AddWarningMessage(FString::Printf(
 				TEXT("Mesh %s has some nearly zero-length tangents which can create some issues. Consider checking 'Recompute Tangents' in the asset settings"),
@@ -68,20 +35,66 @@ namespace
 		}
 	}
 
-	bool HasVertexColors(const FColorVertexBuffer* VertexBuffer)
+	struct FGLTFBatchedSection
 	{
-		const uint32 VertexCount = VertexBuffer->GetNumVertices();
+		const UStaticMeshComponent* StaticMeshComponent;
+		const FStaticMeshLODResources* MeshLOD;
+		const FColorVertexBuffer* ColorBuffer;
+		FGLTFIndexArray SectionIndices;
+	};
+
+	template <typename ElementType>
+	FGLTFJsonAccessorIndex AddVertexAccessor(FGLTFConvertBuilder& Builder, const TArray<ElementType>& Elements, EGLTFJsonComponentType ComponentType, EGLTFJsonAccessorType Type, bool bNormalized = false)
+	{
+		FGLTFJsonAccessor JsonAccessor;
+		JsonAccessor.BufferView = Builder.AddBufferView(Elements, EGLTFJsonBufferTarget::ArrayBuffer);
+		JsonAccessor.ComponentType = ComponentType;
+		JsonAccessor.Count = Elements.Num();
+		JsonAccessor.Type = Type;
+		JsonAccessor.bNormalized = bNormalized;
+
+		return Builder.AddAccessor(JsonAccessor);
+	}
 
-		for (uint32 VertexIndex = 0; VertexIndex < VertexCount; VertexIndex++)
+	FGLTFJsonAccessorIndex AddPositionAccessor(FGLTFConvertBuilder& Builder, const TArray<FGLTFVector3>& Positions)
+	{
+		const FGLTFJsonAccessorIndex AccessorIndex = AddVertexAccessor(Builder, Positions, EGLTFJsonComponentType::F32, EGLTFJsonAccessorType::Vec3);
+		FGLTFJsonAccessor& JsonAccessor = Builder.GetAccessor(AccessorIndex);
+		JsonAccessor.MinMaxLength = 3;
+
+		for (int32 ComponentIndex = 0; ComponentIndex < JsonAccessor.MinMaxLength; ComponentIndex++)
 		{
-			const FColor& Color = VertexBuffer->VertexColor(VertexIndex);
-			if (Color != FColor::White)
+			JsonAccessor.Min[ComponentIndex] = Positions[0].Components[ComponentIndex];
+			JsonAccessor.Max[ComponentIndex] = Positions[0].Components[ComponentIndex];
+
+			for (const FGLTFVector3& Position : Positions)
 			{
-				return true;
+				JsonAccessor.Min[ComponentIndex] = FMath::Min(JsonAccessor.Min[ComponentIndex], Position.Components[ComponentIndex]);
+				JsonAccessor.Max[ComponentIndex] = FMath::Max(JsonAccessor.Max[ComponentIndex], Position.Components[ComponentIndex]);
 			}
 		}
 
-		return false;
+		return AccessorIndex;
+	}
+
+	template <typename IndexType>
+	FGLTFJsonAccessorIndex AddIndexAccessor(FGLTFConvertBuilder& Builder, const TArray<uint32>& IndexBuffer)
+	{
+		TArray<IndexType> Indices;
+		Indices.AddUninitialized(IndexBuffer.Num());
+
+		for (int32 Index = 0; Index < IndexBuffer.Num(); ++Index)
+		{
+			Indices[Index] = static_cast<IndexType>(IndexBuffer[Index]);
+		}
+
+		FGLTFJsonAccessor JsonAccessor;
+		JsonAccessor.BufferView = Builder.AddBufferView(Indices, EGLTFJsonBufferTarget::ElementArrayBuffer, sizeof(IndexType));
+		JsonAccessor.ComponentType = FGLTFConverterUtility::GetComponentType<IndexType>();
+		JsonAccessor.Count = Indices.Num();
+		JsonAccessor.Type = EGLTFJsonAccessorType::Scalar;
+
+		return Builder.AddAccessor(JsonAccessor);
 	}
 }
 
@@ -95,7 +108,7 @@ void FGLTFStaticMeshTask::Complete()
 	const FStaticMeshVertexBuffer* VertexBuffer = &MeshLOD.VertexBuffers.StaticMeshVertexBuffer;
 	const FColorVertexBuffer* ColorBuffer = &MeshLOD.VertexBuffers.ColorVertexBuffer; // TODO: add support for overriding color buffer by component
 
-	if (Builder.ExportOptions->bExportVertexColors && HasVertexColors(ColorBuffer))
+	if (Builder.ExportOptions->bExportVertexColors && Builder.ColorBufferAnalysisConverter.GetOrAdd(ColorBuffer))
 	{
 		Builder.AddWarningMessage(FString::Printf(
 			TEXT("Vertex colors in mesh %s will act as a multiplier for base color in glTF, regardless of material, which may produce undesirable results."),
@@ -134,15 +147,45 @@ void FGLTFStaticMeshTask::Complete()
 	const int32 MaterialCount = StaticMesh->StaticMaterials.Num();
 	JsonMesh.Primitives.AddDefaulted(MaterialCount);
 
+	// When sharing vertex streams, all primitives use the vertex attributes of a section spanning the whole LOD, and only differ in indices
+	const FGLTFMeshSection* VertexSection = Builder.ExportOptions->bShareVertexStreams && MaterialCount > 1 ?
+		MeshSectionConverter.GetOrAdd(&MeshLOD, FGLTFMeshUtility::GetAllSectionIndices(MeshLOD)) : nullptr;
+
+	// Sections are simplified before any accessors are converted from them, so all vertex attributes (and indices) refer to the same simplified vertices
+	const float SimplificationRatio = Builder.MeshSimplificationBudget.GetRatio(MeshIndex);
+	if (VertexSection != nullptr && SimplificationRatio < 1)
+	{
+		VertexSection = SimplifiedMeshSectionConverter.GetOrAdd(VertexSection, PositionBuffer, SimplificationRatio);
+	}
+
 	for (int32 MaterialIndex = 0; MaterialIndex < MaterialCount; ++MaterialIndex)
 	{
 		const FGLTFIndexArray SectionIndices = FGLTFMeshUtility::GetSectionIndices(MeshLOD, MaterialIndex);
-		const FGLTFMeshSection* ConvertedSection = MeshSectionConverter.GetOrAdd(&MeshLOD, SectionIndices);
+		const FGLTFMeshSection* ConvertedSection = nullptr;
+		const FGLTFMeshSection* IndexSection = nullptr;
+
+		if (VertexSection != nullptr && SectionIndices.Num() > 0)
+		{
+			ConvertedSection = VertexSection;
+			IndexSection = SharedMeshSectionConverter.GetOrAdd(VertexSection, SectionIndices);
+		}
+		else
+		{
+			ConvertedSection = MeshSectionConverter.GetOrAdd(&MeshLOD, SectionIndices);
+			if (SimplificationRatio < 1)
+			{
+				ConvertedSection = SimplifiedMeshSectionConverter.GetOrAdd(ConvertedSection, PositionBuffer, SimplificationRatio);
+			}
+
+			IndexSection = ConvertedSection;
+		}
 
 		FGLTFJsonPrimitive& JsonPrimitive = JsonMesh.Primitives[MaterialIndex];
-		JsonPrimitive.Indices = Builder.GetOrAddIndexAccessor(ConvertedSection);
+		JsonPrimitive.Indices = Builder.GetOrAddIndexAccessor(IndexSection);
 
-		JsonPrimitive.Attributes.Position = Builder.GetOrAddPositionAccessor(ConvertedSection, PositionBuffer);
+		JsonPrimitive.Attributes.Position = JsonMesh.bQuantizedPositions
+			? Builder.GetOrAddQuantizedPositionAccessor(ConvertedSection, PositionBuffer)
+			: Builder.GetOrAddPositionAccessor(ConvertedSection, PositionBuffer);
 		if (JsonPrimitive.Attributes.Position == INDEX_NONE)
 		{
 			// TODO: report warning?
@@ -184,9 +227,8 @@ void FGLTFSkeletalMeshTask::Complete()
 	const FColorVertexBuffer* ColorBuffer = &MeshLOD.StaticVertexBuffers.ColorVertexBuffer; // TODO: add support for overriding color buffer by component
 	const FSkinWeightVertexBuffer* SkinWeightBuffer = MeshLOD.GetSkinWeightVertexBuffer(); // TODO: add support for overriding skin weight buffer by component
 	// TODO: add support for skin weight profiles?
-	// TODO: add support for morph targets
 
-	if (Builder.ExportOptions->bExportVertexColors && HasVertexColors(ColorBuffer))
+	if (Builder.ExportOptions->bExportVertexColors && Builder.ColorBufferAnalysisConverter.GetOrAdd(ColorBuffer))
 	{
 		Builder.AddWarningMessage(FString::Printf(
 			TEXT("Vertex colors in mesh %s will act as a multiplier for base color in glTF, regardless of material, which may produce undesirable results."),
@@ -226,13 +268,78 @@ void FGLTFSkeletalMeshTask::Complete()
 	const uint16 MaterialCount = SkeletalMesh->Materials.Num();
 	JsonMesh.Primitives.AddDefaulted(MaterialCount);
 
+	// All morph targets are exported (even without deltas for this LOD), since every primitive must have the same targets
+	const TArray<const UMorphTarget*> MorphTargets = Builder.ExportOptions->bExportMorphTargets ? FGLTFMeshUtility::GetMorphTargets(SkeletalMesh) : TArray<const UMorphTarget*>();
+	for (const UMorphTarget* MorphTarget : MorphTargets)
+	{
+		JsonMesh.TargetNames.Add(MorphTarget->GetName());
+	}
+
+	// When sharing vertex streams, all primitives use the vertex attributes of a section spanning the whole LOD, and only differ in indices
+	const FGLTFMeshSection* VertexSection = Builder.ExportOptions->bShareVertexStreams && MaterialCount > 1 ?
+		MeshSectionConverter.GetOrAdd(&MeshLOD, FGLTFMeshUtility::GetAllSectionIndices(MeshLOD)) : nullptr;
+
+	// Sections are simplified before any accessors are converted from them, so all vertex attributes (and indices) refer to the same simplified vertices
+	const float SimplificationRatio = Builder.MeshSimplificationBudget.GetRatio(MeshIndex);
+	if (VertexSection != nullptr && SimplificationRatio < 1)
+	{
+		VertexSection = SimplifiedMeshSectionConverter.GetOrAdd(VertexSection, PositionBuffer, SimplificationRatio);
+	}
+
+	// When split by joint palettes, only the triangles of this mesh's palette are kept (after any simplification), and joints are remapped to the palette
+	const FGLTFJointPalettes* JointPalettes = PaletteIndex != INDEX_NONE && SkinWeightBuffer != nullptr ? Builder.GetOrAddJointPalettes(SkeletalMesh, LODIndex) : nullptr;
+	const FGLTFSkinJoints* SkinJoints = JointPalettes != nullptr ? &JointPalettes->Palettes[PaletteIndex] : Builder.GetOrAddSkinJoints(SkeletalMesh);
+
+	// Triangles that no palette fully contains are left out of every palette, which is reported once (by the first palette)
+	uint32 UncoveredTriangleCount = 0;
+
+	if (VertexSection != nullptr && JointPalettes != nullptr)
+	{
+		const FGLTFSkinWeights* SkinWeights = Builder.GetOrAddSkinWeights(VertexSection, SkinWeightBuffer);
+		UncoveredTriangleCount += PaletteIndex == 0 ? FGLTFJointPaletteUtility::CountUncoveredTriangles(*VertexSection, *SkinWeights, *JointPalettes) : 0;
+		VertexSection = PaletteMeshSectionConverter.GetOrAdd(VertexSection, SkinWeights, JointPalettes, PaletteIndex);
+	}
+
+	TArray<int32> EmptyPrimitives;
+
 	for (uint16 MaterialIndex = 0; MaterialIndex < MaterialCount; ++MaterialIndex)
 	{
 		const FGLTFIndexArray SectionIndices = FGLTFMeshUtility::GetSectionIndices(MeshLOD, MaterialIndex);
-		const FGLTFMeshSection* ConvertedSection = MeshSectionConverter.GetOrAdd(&MeshLOD, SectionIndices);
+		const FGLTFMeshSection* ConvertedSection = nullptr;
+		const FGLTFMeshSection* IndexSection = nullptr;
+
+		if (VertexSection != nullptr && SectionIndices.Num() > 0)
+		{
+			ConvertedSection = VertexSection;
+			IndexSection = SharedMeshSectionConverter.GetOrAdd(VertexSection, SectionIndices);
+		}
+		else
+		{
+			ConvertedSection = MeshSectionConverter.GetOrAdd(&MeshLOD, SectionIndices);
+			if (SimplificationRatio < 1)
+			{
+				ConvertedSection = SimplifiedMeshSectionConverter.GetOrAdd(ConvertedSection, PositionBuffer, SimplificationRatio);
+			}
+
+			if (JointPalettes != nullptr)
+			{
+				const FGLTFSkinWeights* SkinWeights = Builder.GetOrAddSkinWeights(ConvertedSection, SkinWeightBuffer);
+				UncoveredTriangleCount += PaletteIndex == 0 ? FGLTFJointPaletteUtility::CountUncoveredTriangles(*ConvertedSection, *SkinWeights, *JointPalettes) : 0;
+				ConvertedSection = PaletteMeshSectionConverter.GetOrAdd(ConvertedSection, SkinWeights, JointPalettes, PaletteIndex);
+			}
+
+			IndexSection = ConvertedSection;
+		}
+
+		if (JointPalettes != nullptr && IndexSection->IndexBuffer.Num() == 0)
+		{
+			// Materials without any triangles in this palette are left out, since they would only produce empty primitives
+			EmptyPrimitives.Add(MaterialIndex);
+			continue;
+		}
 
 		FGLTFJsonPrimitive& JsonPrimitive = JsonMesh.Primitives[MaterialIndex];
-		JsonPrimitive.Indices = Builder.GetOrAddIndexAccessor(ConvertedSection);
+		JsonPrimitive.Indices = Builder.GetOrAddIndexAccessor(IndexSection);
 
 		JsonPrimitive.Attributes.Position = Builder.GetOrAddPositionAccessor(ConvertedSection, PositionBuffer);
 		if (JsonPrimitive.Attributes.Position == INDEX_NONE)
@@ -260,19 +367,206 @@ void FGLTFSkeletalMeshTask::Complete()
 
 		if (Builder.ExportOptions->bExportVertexSkinWeights)
 		{
-			const uint32 GroupCount = (SkinWeightBuffer->GetMaxBoneInfluences() + 3) / 4;
-			// TODO: report warning or option to limit groups (of joints and weights) since most viewers don't support more than one?
+			// Number of influences may be limited by export options, in which case the skin weights have already been renormalized
+			const FGLTFSkinWeights* SkinWeights = Builder.GetOrAddSkinWeights(ConvertedSection, SkinWeightBuffer);
+			const uint32 GroupCount = SkinWeights != nullptr ? SkinWeights->InfluenceCount / 4 : 0;
 			JsonPrimitive.Attributes.Joints.AddUninitialized(GroupCount);
 			JsonPrimitive.Attributes.Weights.AddUninitialized(GroupCount);
 
 			for (uint32 GroupIndex = 0; GroupIndex < GroupCount; ++GroupIndex)
 			{
-				JsonPrimitive.Attributes.Joints[GroupIndex] = Builder.GetOrAddJointAccessor(ConvertedSection, SkinWeightBuffer, GroupIndex * 4);
+				JsonPrimitive.Attributes.Joints[GroupIndex] = Builder.GetOrAddJointAccessor(ConvertedSection, SkinWeightBuffer, GroupIndex * 4, SkinJoints);
 				JsonPrimitive.Attributes.Weights[GroupIndex] = Builder.GetOrAddWeightAccessor(ConvertedSection, SkinWeightBuffer, GroupIndex * 4);
 			}
 		}
 
+		JsonPrimitive.Targets.AddDefaulted(MorphTargets.Num());
+
+		for (int32 TargetIndex = 0; TargetIndex < MorphTargets.Num(); ++TargetIndex)
+		{
+			FGLTFJsonMorphTarget& JsonTarget = JsonPrimitive.Targets[TargetIndex];
+			JsonTarget.Position = Builder.GetOrAddMorphTargetPositionAccessor(ConvertedSection, MorphTargets[TargetIndex], LODIndex);
+
+			if (JsonPrimitive.Attributes.Normal != INDEX_NONE)
+			{
+				JsonTarget.Normal = Builder.GetOrAddMorphTargetNormalAccessor(ConvertedSection, MorphTargets[TargetIndex], LODIndex);
+			}
+		}
+
 		const UMaterialInterface* Material = Materials[MaterialIndex];
 		JsonPrimitive.Material =  Builder.GetOrAddMaterial(Material, MeshData, SectionIndices);
 	}
+
+	for (int32 Index = EmptyPrimitives.Num() - 1; Index >= 0; --Index)
+	{
+		JsonMesh.Primitives.RemoveAt(EmptyPrimitives[Index]);
+	}
+
+	if (UncoveredTriangleCount > 0)
+	{
+		Builder.AddWarningMessage(FString::Printf(
+			TEXT("%d triangle(s) in skeletal mesh %s (LOD %d) are skinned by bones that no joint palette contains, and were left out"),
+			UncoveredTriangleCount,
+			*SkeletalMesh->GetName(),
+			LODIndex));
+	}
+}
+
+void FGLTFStaticMeshBatchTask::Complete()
+{
+	const float ExportScale = Builder.ExportOptions->ExportUniformScale;
+
+	// Sections of all components are grouped by material, and each group is merged into a single primitive
+	TArray<const UMaterialInterface*> PrimitiveMaterials;
+	TArray<TArray<FGLTFBatchedSection>> PrimitiveSections;
+
+	for (const UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
+	{
+		const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+		const int32 LODIndex = FGLTFMeshUtility::GetLOD(StaticMesh, StaticMeshComponent, Builder.ExportOptions->DefaultLevelOfDetail);
+		const FStaticMeshLODResources& MeshLOD = StaticMesh->GetLODForExport(LODIndex);
+
+		const FColorVertexBuffer* ColorBuffer = &MeshLOD.VertexBuffers.ColorVertexBuffer;
+		if (StaticMeshComponent->LODData.IsValidIndex(LODIndex) && StaticMeshComponent->LODData[LODIndex].OverrideVertexColors != nullptr)
+		{
+			ColorBuffer = StaticMeshComponent->LODData[LODIndex].OverrideVertexColors;
+		}
+
+		if (!Builder.ExportOptions->bExportVertexColors || !Builder.ColorBufferAnalysisConverter.GetOrAdd(ColorBuffer))
+		{
+			ColorBuffer = nullptr;
+		}
+
+		FGLTFMaterialArray Materials;
+		FGLTFMaterialUtility::ResolveOverrides(Materials, StaticMeshComponent->GetMaterials());
+
+		for (int32 MaterialIndex = 0; MaterialIndex < Materials.Num(); ++MaterialIndex)
+		{
+			const FGLTFIndexArray SectionIndices = FGLTFMeshUtility::GetSectionIndices(MeshLOD, MaterialIndex);
+			if (SectionIndices.Num() == 0)
+			{
+				continue;
+			}
+
+			int32 PrimitiveIndex = PrimitiveMaterials.Find(Materials[MaterialIndex]);
+			if (PrimitiveIndex == INDEX_NONE)
+			{
+				PrimitiveIndex = PrimitiveMaterials.Add(Materials[MaterialIndex]);
+				PrimitiveSections.AddDefaulted();
+			}
+
+			PrimitiveSections[PrimitiveIndex].Add({ StaticMeshComponent, &MeshLOD, ColorBuffer, SectionIndices });
+		}
+	}
+
+	FGLTFJsonMesh& JsonMesh = Builder.GetMesh(MeshIndex);
+
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < PrimitiveMaterials.Num(); ++PrimitiveIndex)
+	{
+		const TArray<FGLTFBatchedSection>& Sections = PrimitiveSections[PrimitiveIndex];
+		FGLTFJsonPrimitive JsonPrimitive;
+
+		// Attributes missing from some of the merged sections are filled with defaults (i.e. zero texture coordinates and white colors)
+		uint32 UVCount = 0;
+		bool bHasColors = false;
+
+		for (const FGLTFBatchedSection& Section : Sections)
+		{
+			UVCount = FMath::Max(UVCount, Section.MeshLOD->VertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords());
+			bHasColors |= Section.ColorBuffer != nullptr;
+		}
+
+		TArray<FGLTFVector3> Positions;
+		TArray<FGLTFVector3> Normals;
+		TArray<FGLTFVector4> Tangents;
+		TArray<FGLTFUInt8Color4> Colors;
+		TArray<TArray<FGLTFVector2>> UVs;
+		TArray<uint32> Indices;
+		UVs.SetNum(UVCount);
+
+		for (const FGLTFBatchedSection& Section : Sections)
+		{
+			const FGLTFMeshSection MeshSection(Section.MeshLOD, Section.SectionIndices);
+			const FPositionVertexBuffer& PositionBuffer = Section.MeshLOD->VertexBuffers.PositionVertexBuffer;
+			const FStaticMeshVertexBuffer& VertexBuffer = Section.MeshLOD->VertexBuffers.StaticMeshVertexBuffer;
+
+			// Normals are transformed by the inverse transpose, which for a scale-rotation-translation transform means dividing by the scale before rotating
+			const FTransform& Transform = Section.StaticMeshComponent->GetComponentTransform();
+			const FVector InverseScale = FTransform::GetSafeScaleReciprocal(Transform.GetScale3D());
+			const bool bIsMirrored = Transform.GetDeterminant() < 0;
+
+			const uint32 VertexOffset = Positions.Num();
+			const uint32 SectionUVCount = VertexBuffer.GetNumTexCoords();
+
+			for (const uint32 MappedVertexIndex : MeshSection.IndexMap)
+			{
+				const FVector Normal = Transform.GetRotation().RotateVector(FVector(VertexBuffer.VertexTangentZ(MappedVertexIndex)) * InverseScale).GetSafeNormal();
+				const FVector Tangent = Transform.TransformVector(FVector(VertexBuffer.VertexTangentX(MappedVertexIndex))).GetSafeNormal();
+
+				Positions.Add(FGLTFConverterUtility::ConvertPosition(Transform.TransformPosition(PositionBuffer.VertexPosition(MappedVertexIndex)), ExportScale));
+				Normals.Add(FGLTFConverterUtility::ConvertNormal(Normal));
+				// A mirroring transform also flips the handedness of the tangent basis
+				FGLTFVector4& ConvertedTangent = Tangents.Add_GetRef(FGLTFConverterUtility::ConvertTangent(Tangent));
+				if (bIsMirrored)
+				{
+					ConvertedTangent.W = -ConvertedTangent.W;
+				}
+
+				for (uint32 UVIndex = 0; UVIndex < UVCount; ++UVIndex)
+				{
+					UVs[UVIndex].Add(UVIndex < SectionUVCount ? FGLTFConverterUtility::ConvertUV(VertexBuffer.GetVertexUV(MappedVertexIndex, UVIndex)) : FGLTFVector2{ 0, 0 });
+				}
+
+				if (bHasColors)
+				{
+					const bool bHasColor = Section.ColorBuffer != nullptr && MappedVertexIndex < Section.ColorBuffer->GetNumVertices();
+					Colors.Add(FGLTFConverterUtility::ConvertColor(bHasColor ? Section.ColorBuffer->VertexColor(MappedVertexIndex) : FColor::White));
+				}
+			}
+
+			FGLTFJsonBatchedActor BatchedActor;
+			BatchedActor.Name = FGLTFNameUtility::GetName(Section.StaticMeshComponent);
+			BatchedActor.FirstIndex = Indices.Num();
+			BatchedActor.IndexCount = MeshSection.IndexBuffer.Num();
+
+			for (int32 Index = 0; Index < MeshSection.IndexBuffer.Num(); Index += 3)
+			{
+				// A mirroring transform also flips the winding order of the triangles, which must be reversed to keep the same front face
+				Indices.Add(VertexOffset + MeshSection.IndexBuffer[Index]);
+				Indices.Add(VertexOffset + MeshSection.IndexBuffer[Index + (bIsMirrored ? 2 : 1)]);
+				Indices.Add(VertexOffset + MeshSection.IndexBuffer[Index + (bIsMirrored ? 1 : 2)]);
+			}
+
+			JsonPrimitive.BatchedActors.Add(BatchedActor);
+		}
+
+		if (Positions.Num() == 0)
+		{
+			// Primitives are only added once they have geometry, since a primitive without attributes is invalid
+			continue;
+		}
+
+		JsonPrimitive.Attributes.Position = AddPositionAccessor(Builder, Positions);
+		JsonPrimitive.Attributes.Normal = AddVertexAccessor(Builder, Normals, EGLTFJsonComponentType::F32, EGLTFJsonAccessorType::Vec3);
+		JsonPrimitive.Attributes.Tangent = AddVertexAccessor(Builder, Tangents, EGLTFJsonComponentType::F32, EGLTFJsonAccessorType::Vec4);
+
+		if (bHasColors)
+		{
+			JsonPrimitive.Attributes.Color0 = AddVertexAccessor(Builder, Colors, EGLTFJsonComponentType::U8, EGLTFJsonAccessorType::Vec4, true);
+		}
+
+		for (uint32 UVIndex = 0; UVIndex < UVCount; ++UVIndex)
+		{
+			JsonPrimitive.Attributes.TexCoords.Add(AddVertexAccessor(Builder, UVs[UVIndex], EGLTFJsonComponentType::F32, EGLTFJsonAccessorType::Vec2));
+		}
+
+		JsonPrimitive.Indices = Positions.Num() - 1 <= UINT16_MAX
+			? AddIndexAccessor<uint16>(Builder, Indices)
+			: AddIndexAccessor<uint32>(Builder, Indices);
+
+		// Materials are not baked using mesh data, since the primitive merges many different meshes
+		JsonPrimitive.Material = Builder.GetOrAddMaterial(PrimitiveMaterials[PrimitiveIndex]);
+
+		JsonMesh.Primitives.Add(MoveTemp(JsonPrimitive));
+	}
 }
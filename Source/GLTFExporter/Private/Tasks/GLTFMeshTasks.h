@@ -13,10 +13,12 @@ class FGLTFStaticMeshTask : public FGLTFTask
 {
 public:
 
-	FGLTFStaticMeshTask(FGLTFConvertBuilder& Builder, FGLTFStaticMeshSectionConverter& MeshSectionConverter, const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex, FGLTFJsonMeshIndex MeshIndex)
+	FGLTFStaticMeshTask(FGLTFConvertBuilder& Builder, FGLTFStaticMeshSectionConverter& MeshSectionConverter, FGLTFSharedMeshSectionConverter& SharedMeshSectionConverter, FGLTFSimplifiedMeshSectionConverter& SimplifiedMeshSectionConverter, const UStaticMesh* StaticMesh, const UStaticMeshComponent* StaticMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex, FGLTFJsonMeshIndex MeshIndex)
 		: FGLTFTask(EGLTFTaskPriority::Mesh)
 		, Builder(Builder)
 		, MeshSectionConverter(MeshSectionConverter)
+		, SharedMeshSectionConverter(SharedMeshSectionConverter)
+		, SimplifiedMeshSectionConverter(SimplifiedMeshSectionConverter)
 		, StaticMesh(StaticMesh)
 		, StaticMeshComponent(StaticMeshComponent)
 		, Materials(Materials)
@@ -36,6 +38,8 @@ private:
 
 	FGLTFConvertBuilder& Builder;
 	FGLTFStaticMeshSectionConverter& MeshSectionConverter;
+	FGLTFSharedMeshSectionConverter& SharedMeshSectionConverter;
+	FGLTFSimplifiedMeshSectionConverter& SimplifiedMeshSectionConverter;
 	const UStaticMesh* StaticMesh;
 	const UStaticMeshComponent* StaticMeshComponent;
 	const FGLTFMaterialArray Materials;
@@ -47,14 +51,18 @@ class FGLTFSkeletalMeshTask : public FGLTFTask
 {
 public:
 
-	FGLTFSkeletalMeshTask(FGLTFConvertBuilder& Builder, FGLTFSkeletalMeshSectionConverter& MeshSectionConverter, const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex, FGLTFJsonMeshIndex MeshIndex)
+	FGLTFSkeletalMeshTask(FGLTFConvertBuilder& Builder, FGLTFSkeletalMeshSectionConverter& MeshSectionConverter, FGLTFSharedMeshSectionConverter& SharedMeshSectionConverter, FGLTFSimplifiedMeshSectionConverter& SimplifiedMeshSectionConverter, FGLTFPaletteMeshSectionConverter& PaletteMeshSectionConverter, const USkeletalMesh* SkeletalMesh, const USkeletalMeshComponent* SkeletalMeshComponent, FGLTFMaterialArray Materials, int32 LODIndex, int32 PaletteIndex, FGLTFJsonMeshIndex MeshIndex)
 		: FGLTFTask(EGLTFTaskPriority::Mesh)
 		, Builder(Builder)
 		, MeshSectionConverter(MeshSectionConverter)
+		, SharedMeshSectionConverter(SharedMeshSectionConverter)
+		, SimplifiedMeshSectionConverter(SimplifiedMeshSectionConverter)
+		, PaletteMeshSectionConverter(PaletteMeshSectionConverter)
 		, SkeletalMesh(SkeletalMesh)
 		, SkeletalMeshComponent(SkeletalMeshComponent)
 		, Materials(Materials)
 		, LODIndex(LODIndex)
+		, PaletteIndex(PaletteIndex)
 		, MeshIndex(MeshIndex)
 	{
 	}
@@ -70,9 +78,39 @@ private:
 
 	FGLTFConvertBuilder& Builder;
 	FGLTFSkeletalMeshSectionConverter& MeshSectionConverter;
+	FGLTFSharedMeshSectionConverter& SharedMeshSectionConverter;
+	FGLTFSimplifiedMeshSectionConverter& SimplifiedMeshSectionConverter;
+	FGLTFPaletteMeshSectionConverter& PaletteMeshSectionConverter;
 	const USkeletalMesh* SkeletalMesh;
 	const USkeletalMeshComponent* SkeletalMeshComponent;
 	const FGLTFMaterialArray Materials;
 	const int32 LODIndex;
+	const int32 PaletteIndex;
+	const FGLTFJsonMeshIndex MeshIndex;
+};
+
+class FGLTFStaticMeshBatchTask : public FGLTFTask
+{
+public:
+
+	FGLTFStaticMeshBatchTask(FGLTFConvertBuilder& Builder, const TArray<const UStaticMeshComponent*>& StaticMeshComponents, FGLTFJsonMeshIndex MeshIndex)
+		: FGLTFTask(EGLTFTaskPriority::Mesh)
+		, Builder(Builder)
+		, StaticMeshComponents(StaticMeshComponents)
+		, MeshIndex(MeshIndex)
+	{
+	}
+
+	virtual FString GetName() override
+	{
+		return Builder.GetMesh(MeshIndex).Name;
+	}
+
+	virtual void Complete() override;
+
+private:
+
+	FGLTFConvertBuilder& Builder;
+	const TArray<const UStaticMeshComponent*> StaticMeshComponents;
 	const FGLTFJsonMeshIndex MeshIndex;
 };
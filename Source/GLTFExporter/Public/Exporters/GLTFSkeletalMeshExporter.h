@@ -5,6 +5,9 @@
 #include "Exporters/GLTFExporter.h"
 #include "GLTFSkeletalMeshExporter.generated.h"
 
+class USkeletalMesh;
+class UAnimSequence;
+
 UCLASS()
 class GLTFEXPORTER_API UGLTFSkeletalMeshExporter final : public UGLTFExporter
 {
@@ -15,4 +18,8 @@ public:
 	explicit UGLTFSkeletalMeshExporter(const FObjectInitializer& ObjectInitializer = FObjectInitializer());
 
 	virtual bool AddObject(FGLTFContainerBuilder& Builder, const UObject* Object) override;
+
+	// Exports a skeletal mesh together with the given animation sequences to a single file, where all animations share one skin and set of joint nodes.
+	// If no animation sequences are given, all animation sequences for the skeleton of the mesh will be exported. Default export options are used if none are given.
+	static bool ExportAnimationLibrary(const USkeletalMesh* SkeletalMesh, const TArray<UAnimSequence*>& AnimSequences, const FString& FilePath, const UGLTFExportOptions* Options = nullptr);
 };
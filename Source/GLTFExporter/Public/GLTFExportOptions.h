@@ -124,6 +124,14 @@ class GLTFEXPORTER_API UGLTFExportOptions : public UObject
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0"))
 	int32 DefaultLevelOfDetail;
 
+	/** If enabled, export lower levels of detail (starting from the LOD determined above) as separate meshes that viewers can switch between based on screen coverage. Uses extension MSFT_lod, which is not supported by all glTF viewers. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh)
+	bool bExportLevelsOfDetail;
+
+	/** Lowest-detail LOD level exported when exporting levels of detail, or -1 for all available levels. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "-1", EditCondition = "bExportLevelsOfDetail"))
+	int32 MaximumLevelOfDetail;
+
 	/** If enabled, export vertex color. Not recommended due to vertex colors always being used as a base color multiplier in glTF, regardless of material. Often producing undesirable results. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh)
 	bool bExportVertexColors;
@@ -132,14 +140,58 @@ class GLTFEXPORTER_API UGLTFExportOptions : public UObject
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh)
 	bool bExportVertexSkinWeights;
 
-	/** If enabled, use quantization for vertex tangents and normals, reducing size. Requires extension KHR_mesh_quantization, which may result in the mesh not loading in some glTF viewers. */
+	/** Maximum number of bone influences exported per vertex, or 0 for all influences. The most significant influences are kept and their weights renormalized. Most glTF viewers only support 4 influences. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0", EditCondition = "bExportVertexSkinWeights"))
+	int32 MaximumBoneInfluences;
+
+	/** If enabled, strip bones from the exported skin that don't deform any vertex (in any LOD) and have no sockets, unless they are the ancestor of another exported bone. Animation tracks of stripped bones are skipped. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (EditCondition = "bExportVertexSkinWeights"))
+	bool bStripUnusedBones;
+
+	/** Maximum number of joints per skinned primitive, or 0 for no limit. Skeletal meshes that need more are split into separate meshes, each with its own skin of at most this many joints, since many WebGL and mobile viewers are limited to 64 or 128 joints per draw. Not applied when exporting variant sets, simplifying meshes, or when a component overrides skin weights. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0", EditCondition = "bExportVertexSkinWeights"))
+	int32 MaximumJointsPerPrimitive;
+
+	/** If enabled, export morph targets of skeletal meshes, only storing the vertices that each target moves. The weights assigned to each skeletal mesh component are exported as its default weights. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh)
+	bool bExportMorphTargets;
+
+	/** Ratio of triangles kept when exporting each mesh, simplified by collapsing edges with the least error. Vertices on UV seams and open borders are preserved. A ratio of 1 disables simplification. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0", ClampMax = "1"))
+	float MeshSimplificationRatio;
+
+	/** Maximum number of triangles exported per mesh, or 0 for no limit. Meshes with more triangles are simplified as above. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0"))
+	int32 MaximumMeshTriangleCount;
+
+	/** Maximum number of triangles exported across all meshes, or 0 for no limit. The budget is distributed by the size of each mesh's bounds, so meshes likely to cover more of the screen keep more of their triangles. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0"))
+	int32 SceneTriangleBudget;
+
+	/** If enabled, use quantization for vertex tangents and normals, as well as positions and texture coordinates within the tolerances below, reducing size. Requires extension KHR_mesh_quantization, which may result in the mesh not loading in some glTF viewers. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh)
 	bool bUseMeshQuantization;
 
+	/** Maximum error (in world units) allowed when quantizing the vertex positions of a static mesh. Positions are kept in full precision if the mesh is too large for the tolerance, or if zero. Not applied to mesh components when exporting variant sets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0", EditCondition = "bUseMeshQuantization"))
+	float PositionQuantizationTolerance;
+
+	/** Maximum error allowed when quantizing texture coordinates. Texture coordinates are kept in full precision if they fall outside the range -1 to 1, or if zero. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh, Meta = (ClampMin = "0", EditCondition = "bUseMeshQuantization"))
+	float TexCoordQuantizationTolerance;
+
+	/** If enabled, primitives of the same mesh will share vertex attribute accessors and only have separate index accessors, reducing size when a mesh uses multiple materials. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Mesh)
+	bool bShareVertexStreams;
+
 	/** If enabled, export level sequences. Only transform tracks are currently supported. The level sequence will be played at the assigned display rate. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation)
 	bool bExportLevelSequences;
 
+	/** If enabled, export the keys and tangents of level sequence translation and scale tracks as cubic splines, instead of sampling them at every frame. Rotations, and tracks using constant or weighted keys, are still sampled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (EditCondition = "bExportLevelSequences"))
+	bool bExportLevelSequenceKeys;
+
 	/** If enabled, export single animation asset used by a skeletal mesh component or hotspot actor. Export of vertex skin weights must be enabled. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (EditCondition = "bExportVertexSkinWeights"))
 	bool bExportAnimationSequences;
@@ -148,10 +200,42 @@ class GLTFEXPORTER_API UGLTFExportOptions : public UObject
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (EditCondition = "bExportVertexSkinWeights && bExportAnimationSequences"))
 	bool bRetargetBoneTransforms;
 
+	/** Frame rate (in frames per second) that animation sequences will be resampled to, if lower than their original frame rate. Animation sequences are exported at their original frame rate if zero. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (ClampMin = "0", EditCondition = "bExportVertexSkinWeights && bExportAnimationSequences"))
+	int32 AnimationSampleRate;
+
+	/** If enabled, exporting a skeletal mesh will also export all animation sequences for its skeleton, sharing one skin and set of joint nodes. Export of vertex skin weights must be enabled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (EditCondition = "bExportVertexSkinWeights && bExportAnimationSequences"))
+	bool bExportAnimationLibrary;
+
 	/** If enabled, export play rate, start time, looping, and auto play for an animation or level sequence. Uses extension EPIC_animation_playback, which is supported by Unreal's glTF viewer. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation)
 	bool bExportPlaybackSettings;
 
+	/** If enabled, remove animation keys that can be reproduced by interpolating their neighbours within the tolerances below. Constant channels are collapsed to a single key, or omitted altogether if they match the rest pose of their node. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation)
+	bool bReduceAnimationKeys;
+
+	/** Maximum distance (in world units) that a reduced translation channel may deviate from the original keys. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (ClampMin = "0", EditCondition = "bReduceAnimationKeys"))
+	float AnimationTranslationTolerance;
+
+	/** Maximum angle (in degrees) that a reduced rotation channel may deviate from the original keys. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (ClampMin = "0", EditCondition = "bReduceAnimationKeys"))
+	float AnimationRotationTolerance;
+
+	/** Maximum difference that a reduced scale channel may deviate from the original keys. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (ClampMin = "0", EditCondition = "bReduceAnimationKeys"))
+	float AnimationScaleTolerance;
+
+	/** If enabled, export animated rotations as normalized 8- or 16-bit integers when within the tolerance below, reducing size. Translations and scales are always exported in full precision, since glTF requires them to be floating point. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation)
+	bool bUseAnimationQuantization;
+
+	/** Maximum angle (in degrees) that a quantized rotation may deviate from its full precision value. Rotations are kept in full precision if the tolerance can't be met, or if zero. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Animation, Meta = (ClampMin = "0", EditCondition = "bUseAnimationQuantization"))
+	float RotationQuantizationTolerance;
+
 	/** Desired image format used for exported textures. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Texture)
 	EGLTFTextureImageFormat TextureImageFormat;
@@ -180,6 +264,34 @@ class GLTFEXPORTER_API UGLTFExportOptions : public UObject
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene)
 	bool bExportHiddenInGame;
 
+	/** If enabled, export instanced static mesh components (including hierarchical instances and foliage) as a single node with a transform per instance. Uses extension EXT_mesh_gpu_instancing, which is not supported by all glTF viewers. Lightmaps of instances are not exported. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene)
+	bool bExportMeshInstances;
+
+	/** If enabled, also export static mesh actors that have static mobility and share the same mesh and materials as a single instanced node. Not applied when exporting lightmaps or variant sets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene, Meta = (EditCondition = "bExportMeshInstances"))
+	bool bInstanceRepeatedMeshes;
+
+	/** If enabled, merge static mesh actors that have static mobility (and are not instanced) into combined meshes in world space, with one primitive per material. The source actor of each merged range of indices is written as extras. Not applied when exporting lightmaps or variant sets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene)
+	bool bBatchStaticMeshes;
+
+	/** Size (in world units) of the grid cells used to cluster actors into separate batches, keeping each batch local enough to be culled by viewers, or 0 to merge all actors into a single batch. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene, Meta = (ClampMin = "0", EditCondition = "bBatchStaticMeshes"))
+	float StaticMeshBatchClusterSize;
+
+	/** If enabled, split the level into tiles on a regular grid, each written to its own file, along with a manifest that describes a hierarchy of tile bounds to stream from. Not applied when exporting variant sets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene)
+	bool bExportLevelTiles;
+
+	/** Size (in world units) of the grid cells used to split the level into tiles. Each actor is assigned to the tile containing the center of the bounds of its root actor. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene, Meta = (ClampMin = "0", EditCondition = "bExportLevelTiles"))
+	float LevelTileSize;
+
+	/** Number of actors converted in each pass when exporting a level, after which all pending meshes, materials and textures are completed and their intermediate data released, lowering peak memory when exporting large levels. Actors are visited in spatially coherent order. 0 converts all actors in a single pass. Not applied when using a scene triangle budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene, Meta = (ClampMin = "0"))
+	int32 ActorsPerExportPass;
+
 	/** Mobility of directional, point, and spot light components that will be exported. Uses extension KHR_lights_punctual. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = Scene, Meta = (Bitmask, BitmaskEnum = EGLTFSceneMobility))
 	int32 ExportLights;